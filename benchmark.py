@@ -0,0 +1,261 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+import yaml
+
+from ia32doc.doc import Doc
+from ia32doc.ir import DocIr
+
+from main import ALL_CONFIGS, ALL_FILE, CACHE_DIRECTORY
+
+SCALES = [ 1, 10, 100 ]
+
+#
+# Shapes of the synthesized documents (see yaml/template.yml).
+#
+SYNTHETIC_GROUP_DEPTH = 3
+SYNTHETIC_DEFINITION_COUNT = 4
+SYNTHETIC_ENUM_FIELD_COUNT = 48
+SYNTHETIC_BITFIELD_FIELD_COUNT = 40
+SYNTHETIC_STRUCT_FIELD_COUNT = 8
+
+SYNTHETIC_DESCRIPTION = (
+    'Synthetic description of the object used for benchmarking of the generator. '
+    'It is long enough to be wrapped into several lines, similarly to descriptions '
+    'copied from the Intel manual.\n'
+    '\n'
+    'Second paragraph of the description.\n'
+)
+
+
+def make_details(name: str, index: int) -> dict:
+    return {
+        'short_name': f'{name}{index}',
+        'long_name': f'{name}_{index}',
+        'short_description': f'{name.capitalize()} {index}',
+        'long_description': SYNTHETIC_DESCRIPTION,
+        'reference': f'Vol3A[{index}.{index % 7}(Synthetic)]',
+    }
+
+
+def make_definition(index: int) -> dict:
+    return {
+        **make_details('DEFINITION', index),
+        'value': 0x1000 + index,
+    }
+
+
+def make_enum(index: int) -> dict:
+    return {
+        **make_details('ENUM', index),
+        'type': 'enum',
+        'fields': [
+            {
+                **make_details(f'ENUM_{index}_FIELD', i),
+                'value': i,
+            }
+            for i in range(SYNTHETIC_ENUM_FIELD_COUNT)
+        ],
+    }
+
+
+def make_bitfield(index: int) -> dict:
+    fields = []
+    bit = 0
+
+    for i in range(SYNTHETIC_BITFIELD_FIELD_COUNT):
+        #
+        # Mix of single bits and bit ranges filling the whole 64 bits.
+        #
+        width = 1 if i % 3 else 2
+        if bit + width > 64:
+            break
+
+        fields.append({
+            'bit': bit if width == 1 else f'{bit}-{bit + width - 1}',
+            **make_details(f'BITFIELD_{index}_FIELD', i),
+        })
+
+        bit += width + (1 if i % 5 == 4 else 0)
+
+    return {
+        **make_details('BITFIELD', index),
+        'type': 'bitfield',
+        'size': 64,
+        'fields': fields,
+    }
+
+
+def make_struct(index: int) -> dict:
+    return {
+        **make_details('STRUCT', index),
+        'type': 'struct',
+        'size': SYNTHETIC_STRUCT_FIELD_COUNT * 32,
+        'fields': [
+            {
+                **make_details(f'STRUCT_{index}_FIELD', i),
+                'size': 32,
+            }
+            for i in range(SYNTHETIC_STRUCT_FIELD_COUNT)
+        ],
+    }
+
+
+def make_group(index: int, depth: int) -> dict:
+    fields = [ make_definition(index * SYNTHETIC_DEFINITION_COUNT + i) for i in range(SYNTHETIC_DEFINITION_COUNT) ]
+
+    if depth > 1:
+        fields.append(make_group(index, depth - 1))
+    else:
+        fields += [ make_enum(index), make_bitfield(index), make_struct(index) ]
+
+    return {
+        **make_details(f'GROUP_{depth}_', index),
+        'type': 'group',
+        'fields': fields,
+    }
+
+
+def make_corpus(directory: str, records: int) -> int:
+    '''
+    Writes synthetic YAML corpus of (at least) given number of records into
+    the directory, one file per top-level group. Returns the number of records.
+    '''
+
+    os.makedirs(directory, exist_ok=True)
+
+    #
+    # Number of records in one top-level group:
+    #   root group + nested groups + definitions, enum, bitfield, struct and their fields.
+    #
+    records_per_group = SYNTHETIC_GROUP_DEPTH * (1 + SYNTHETIC_DEFINITION_COUNT) + \
+                        len(make_enum(0)['fields']) + 1 + \
+                        len(make_bitfield(0)['fields']) + 1 + \
+                        len(make_struct(0)['fields']) + 1
+
+    group_count = max(1, -(-records // records_per_group))
+    include = []
+
+    for index in range(group_count):
+        name = f'Group{index:05}'
+        include.append(name)
+
+        with open(os.path.join(directory, f'{name}.yml'), 'w') as f:
+            yaml.safe_dump([ make_group(index, SYNTHETIC_GROUP_DEPTH) ], f, sort_keys=False, width=120)
+
+    with open(os.path.join(directory, 'index.yml'), 'w') as f:
+        yaml.safe_dump([ {
+            'name': 'SYNTHETIC',
+            'description': 'Synthetic corpus.',
+            'type': 'group',
+            'include': include,
+        } ], f, sort_keys=False)
+
+    return group_count * records_per_group + 1
+
+
+def run_config(config: str, file: str, directory: str) -> dict:
+    #
+    # Every configuration is run in its own process (without the parse cache),
+    # so that the measured time and memory cover the whole generation.
+    #
+    with open(config) as f:
+        options = yaml.safe_load(f) or { }
+
+    name = os.path.splitext(os.path.basename(config))[0]
+    options['output_filename'] = os.path.join(directory, os.path.basename(options.get('output_filename', f'{name}.h')))
+
+    config_path = os.path.join(directory, f'{name}.yml')
+    profile_path = os.path.join(directory, f'{name}.profile.json')
+
+    with open(config_path, 'w') as f:
+        yaml.safe_dump(options, f, sort_keys=False)
+
+    start = time.perf_counter()
+    subprocess.run(
+        [ sys.executable, 'main.py', '-c', config_path, '-f', file, '-j', '1', '--no-cache', '--profile-json', profile_path ],
+        check=True, stderr=subprocess.DEVNULL
+    )
+    seconds = time.perf_counter() - start
+
+    with open(profile_path) as f:
+        profile = json.load(f)
+
+    return {
+        'seconds': seconds,
+        'phases': profile['phases'],
+        'peak_memory': profile['peak_memory']['self'],
+        'bytes': sum(output['bytes'] for output in profile['outputs'].values()),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measures generation time and memory on synthetic YAML corpora '
+                                                 'of multiples of the size of the Intel corpus.')
+
+    parser.add_argument('-s', '--scale',
+                        type=int, required=False, nargs='+',
+                        default=SCALES,
+                        help='Size of the synthetic corpora relative to the Intel corpus')
+
+    parser.add_argument('-c', '--config',
+                        type=str, required=False, nargs='+',
+                        default=ALL_CONFIGS,
+                        help='Configuration file(s)')
+
+    parser.add_argument('-d', '--directory',
+                        type=str, required=False,
+                        help='Directory for the synthetic corpora and outputs (default: temporary directory)')
+
+    parser.add_argument('--json',
+                        type=str, required=False,
+                        help='Write the results into JSON file')
+
+    args = parser.parse_args()
+
+    Doc.cache_directory = CACHE_DIRECTORY
+    records = len(DocIr(Doc.parse(ALL_FILE)))
+    directory = args.directory or tempfile.mkdtemp(prefix='ia32doc-benchmark-')
+    results = []
+
+    print(f'Intel corpus: {records} records, working directory: {directory}')
+    print(f'{"scale":>6} {"records":>9} {"config":<24} {"time":>10} {"us/record":>10} {"vs. 1x":>7} {"memory":>10} {"output":>12}')
+
+    baseline = { }
+
+    for scale in sorted(args.scale):
+        corpus_directory = os.path.join(directory, f'{scale}x')
+        corpus_records = make_corpus(corpus_directory, records * scale)
+
+        file = os.path.join(corpus_directory, 'index.yml')
+
+        for config in args.config:
+            result = run_config(config, file, corpus_directory)
+            result.update(scale=scale, records=corpus_records, config=config)
+            results.append(result)
+
+            #
+            # Time per record relative to the smallest scale, values noticeably
+            # above 1.0 indicate superlinear behavior.
+            #
+            per_record = result['seconds'] / corpus_records
+            relative = per_record / baseline.setdefault(config, per_record)
+
+            print(
+                f'{scale:>5}x {corpus_records:>9} {os.path.basename(config):<24} '
+                f'{result["seconds"]:>8.2f} s {per_record * 1e6:>10.1f} {relative:>7.2f} '
+                f'{(result["peak_memory"] or 0) / (1024 * 1024):>6.1f} MiB {result["bytes"]:>12}'
+            )
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(results, f, indent=2)
+            f.write('\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -1,11 +1,15 @@
 from __future__ import annotations
 from typing import List, Tuple
 
+import hashlib
 import os
+import pickle
 import re
 import sys
 import yaml
 
+from . import __version__
+from .profile import DocProfile
 from .text import DocTextCase
 
 DOC_GROUP           = 'group'
@@ -38,29 +42,146 @@ PDPTE with such an address causes a general-protection fault.
 '''
 MAXPHYADDR = 48
 
+#
+# Prefer LibYAML bindings, if available.
+#
+YAML_LOADER = getattr(yaml, 'CSafeLoader', yaml.SafeLoader)
+
 
 class Doc(object):
     doc_cache = { }
 
+    #
+    # Directory of the persistent cache of parsed YAML files (None = disabled).
+    #
+    cache_directory = None
+
+    #
+    # Path of YAML file -> paths of YAML files included by it (see DocBase._do_include).
+    #
+    include_graph = { }
+
     @staticmethod
     def parse(path: str, parent: DocBase=None) -> List[DocBase]:
         if path in Doc.doc_cache:
             doc_list = Doc.doc_cache[path]
         else:
-            print(f'Parsing "{path}"...', file=sys.stderr)
-            doc_list = yaml.load(open(path, encoding='utf-8').read())
+            with DocProfile.measure('parse', path):
+                doc_list = Doc.load(path)
 
             for doc in doc_list:
                 doc['path'] = path
 
             Doc.doc_cache[path] = doc_list
 
-        return [ Doc.map_class(field, parent) for field in doc_list ]
+        with DocProfile.measure('map', path):
+            return [ Doc.map_class(field, parent) for field in doc_list ]
+
+    @staticmethod
+    def invalidate(path: str) -> None:
+        #
+        # Forget parsed content and includes of the edited file only, so that
+        # the next Doc.parse() loads it again. Files included by it stay in
+        # the cache and are mapped again from there (see DocGenerator.reparse()).
+        #
+        Doc.doc_cache.pop(path, None)
+        Doc.include_graph.pop(path, None)
+
+    @staticmethod
+    def included_paths(path: str) -> List[str]:
+        result = [ path ]
+
+        for included_path in Doc.include_graph.get(path, []):
+            for nested_path in Doc.included_paths(included_path):
+                if nested_path not in result:
+                    result.append(nested_path)
+
+        return result
+
+    @staticmethod
+    def load(path: str) -> List[dict]:
+        with open(path, 'rb') as f:
+            content = f.read()
+
+        if not Doc.cache_directory:
+            print(f'Parsing "{path}"...', file=sys.stderr)
+            return yaml.load(content.decode('utf-8'), Loader=YAML_LOADER)
+
+        #
+        # Cached documents are keyed by content of the YAML file and version
+        # of the generator, therefore stale entries are never loaded.
+        #
+        key = hashlib.sha256()
+        key.update(f'{__version__}:{pickle.HIGHEST_PROTOCOL}:'.encode('utf-8'))
+        key.update(content)
+
+        cache_path = os.path.join(Doc.cache_directory, f'{key.hexdigest()}.pickle')
+
+        try:
+            with open(cache_path, 'rb') as f:
+                return pickle.load(f)
+        except (OSError, pickle.UnpicklingError, EOFError):
+            pass
+
+        print(f'Parsing "{path}"...', file=sys.stderr)
+        doc_list = yaml.load(content.decode('utf-8'), Loader=YAML_LOADER)
+
+        #
+        # Write into temporary file first, so that concurrent runs never
+        # see partially written cache entry.
+        #
+        os.makedirs(Doc.cache_directory, exist_ok=True)
+        cache_path_temporary = f'{cache_path}.{os.getpid()}.tmp'
+
+        with open(cache_path_temporary, 'wb') as f:
+            pickle.dump(doc_list, f, pickle.HIGHEST_PROTOCOL)
+
+        os.replace(cache_path_temporary, cache_path)
+
+        return doc_list
 
     @staticmethod
     def map_class(doc: dict, parent: DocBase=None) -> DocBase:
-        doc_base = DocBase(doc, parent)
-        return globals()[f'Doc{DocTextCase.to_camel_case(doc_base.type)}'](doc, parent)
+        doc_type = Doc.resolve_type(doc, parent)
+        return globals()[f'Doc{DocTextCase.to_camel_case(doc_type)}'](doc, parent)
+
+    @staticmethod
+    def resolve_type(doc: dict, parent: DocBase=None) -> str:
+        if 'type' not in doc:
+            if parent:
+                if parent.type == DOC_ENUM:
+                    doc['type'] = DOC_ENUM_FIELD
+                elif parent.type == DOC_STRUCT and 'size' in doc:
+                    doc['type'] = DOC_STRUCT_FIELD
+                elif parent.type == DOC_BITFIELD and 'bit' in doc:
+                    doc['type'] = DOC_BITFIELD_FIELD
+                else:
+                    doc['type'] = DOC_DEFINITION
+            else:
+                doc['type'] = DOC_DEFINITION
+
+        if 'type' in doc and doc['type'] in DOC_TYPES:
+            return doc['type']
+        else:
+            raise Exception('Invalid type')
+
+
+def resolved_property(method):
+    #
+    # Property of the document, which is computed only until the document
+    # is resolved (see DocIr). Then the frozen value from the resolved
+    # record is returned.
+    #
+    name = method.__name__
+
+    def getter(self):
+        if self._record is not None:
+            return getattr(self._record, name)
+        return method(self)
+
+    getter.__name__ = name
+    getter.__doc__ = method.__doc__
+    return property(getter)
 
 
 class DocBase(object):
@@ -71,6 +192,12 @@ class DocBase(object):
         self._fields = []
         self._include = []
 
+        #
+        # Resolved record and the resolved representation it belongs to (see DocIr).
+        #
+        self._record = None
+        self._ir = None
+
         self.parent = parent
 
         if 'fields' in doc:
@@ -84,26 +211,26 @@ class DocBase(object):
     def __repr__(self):
         return f'[{self.short_name} ({self.type})]'
 
-    @property
+    @resolved_property
     def short_name(self) -> str:
         return self._fix_name(self.short_name_raw)
 
-    @property
+    @resolved_property
     def long_name(self) -> str:
         return self._fix_name(self.long_name_raw)
 
-    @property
+    @resolved_property
     def alternative_name(self) -> str:
         if 'alternative_name' in self._doc:
             return self._make_name(self._doc['alternative_name'])
 
         return ''
 
-    @property
+    @resolved_property
     def short_name_raw(self) -> str:
         return self._make_name(self.short_name_standalone)
 
-    @property
+    @resolved_property
     def short_name_standalone(self) -> str:
         if 'short_name' in self._doc:
             return self._doc['short_name']
@@ -119,11 +246,11 @@ class DocBase(object):
             else:
                 return ''
 
-    @property
+    @resolved_property
     def long_name_raw(self) -> str:
         return self._make_name(self.long_name_standalone)
 
-    @property
+    @resolved_property
     def long_name_standalone(self) -> str:
         if 'long_name' in self._doc:
             return self._doc['long_name']
@@ -139,15 +266,15 @@ class DocBase(object):
             else:
                 return ''
 
-    @property
+    @resolved_property
     def short_description(self) -> str:
         return self.short_description_raw.rstrip().rstrip('.')
 
-    @property
+    @resolved_property
     def long_description(self) -> str:
         return self.long_description_raw.rstrip()
 
-    @property
+    @resolved_property
     def short_description_raw(self) -> str:
         if 'short_description' in self._doc:
             result = self._doc['short_description']
@@ -158,7 +285,7 @@ class DocBase(object):
 
         return self._fix_description(result)
 
-    @property
+    @resolved_property
     def long_description_raw(self) -> str:
         if 'long_description' in self._doc:
             result = self._doc['long_description']
@@ -169,7 +296,7 @@ class DocBase(object):
 
         return self._fix_description(result)
 
-    @property
+    @resolved_property
     def children_name_with_prefix(self) -> str:
         if 'children_name_with_prefix' in self._doc:
             if self._doc['children_name_with_prefix'] != '$':
@@ -178,7 +305,7 @@ class DocBase(object):
                 return self.short_name
         return ''
 
-    @property
+    @resolved_property
     def children_name_with_suffix(self) -> str:
         if 'children_name_with_suffix' in self._doc:
             if self._doc['children_name_with_suffix'] != '$':
@@ -187,69 +314,53 @@ class DocBase(object):
                 return self.short_name
         return ''
 
-    @property
+    @resolved_property
     def note(self) -> str:
         if 'note' in self._doc:
             return self._doc['note']
         return ''
 
-    @property
+    @resolved_property
     def access(self) -> str:
         if 'access' in self._doc:
             return self._doc['access']
         return ''
 
-    @property
+    @resolved_property
     def todo(self) -> str:
         if 'todo' in self._doc:
             return self._doc['todo']
         return ''
 
-    @property
+    @resolved_property
     def tag(self) -> str:
         if 'tag' in self._doc:
             return self._doc['tag']
         return ''
 
-    @property
+    @resolved_property
     def type(self) -> str:
-        if 'type' not in self._doc:
-            if self.parent:
-                if self.parent.type == DOC_ENUM:
-                    self._doc['type'] = DOC_ENUM_FIELD
-                elif self.parent.type == DOC_STRUCT and 'size' in self._doc:
-                    self._doc['type'] = DOC_STRUCT_FIELD
-                elif self.parent.type == DOC_BITFIELD and 'bit' in self._doc:
-                    self._doc['type'] = DOC_BITFIELD_FIELD
-                else:
-                    self._doc['type'] = DOC_DEFINITION
-            else:
-                self._doc['type'] = DOC_DEFINITION
-
-        if 'type' in self._doc and self._doc['type'] in DOC_TYPES:
-            return self._doc['type']
-        else:
-            raise Exception('Invalid type')
+        return Doc.resolve_type(self._doc, self.parent)
 
-    @property
+    @resolved_property
     def alternative_type(self) -> str:
         if 'alternative_type' in self._doc:
             return self._doc['alternative_type']
         return self.type
 
-    @property
+    @resolved_property
     def remarks(self) -> str:
         if 'remarks' in self._doc:
             return self._fix_description(self._doc['remarks'])
         return ''
 
-    @property
+    @resolved_property
     def see(self) -> str:
         if 'see' in self._doc:
             return self._doc['see']
         return ''
 
-    @property
+    @resolved_property
     def reference(self) -> str:
         if 'reference' in self._doc:
             return self._doc['reference']
@@ -263,9 +374,11 @@ class DocBase(object):
     def include(self) -> List[str]:
         return self._include
 
-    @property
+    @resolved_property
     def path(self) -> str:
-        return self._doc['path']
+        if 'path' in self._doc or not self.parent:
+            return self._doc['path']
+        return self.parent.path
 
     def _make_name(self, name: str) -> str:
         candidate_types_for_affix = [ DOC_DEFINITION, DOC_GROUP, DOC_STRUCT, DOC_BITFIELD, DOC_ENUM, DOC_ENUM_FIELD ]
@@ -289,11 +402,20 @@ class DocBase(object):
             dir_path = os.path.join(os.path.dirname(self.path), include, 'index.yml')
 
             if os.path.isfile(file_path):
-                doc_list = Doc.parse(file_path, self)
+                include_path = file_path
             elif os.path.isfile(dir_path):
-                doc_list = Doc.parse(dir_path, self)
+                include_path = dir_path
             else:
-                doc_list = []  # raise Exception(f'Path {self.path} not found')
+                include_path = None  # raise Exception(f'Path {self.path} not found')
+
+            if include_path:
+                include_path_list = Doc.include_graph.setdefault(self.path, [])
+                if include_path not in include_path_list:
+                    include_path_list.append(include_path)
+
+                doc_list = Doc.parse(include_path, self)
+            else:
+                doc_list = []
 
             for doc in doc_list:
                 self._fields.append(doc)
@@ -342,7 +464,7 @@ class DocDefinition(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
-    @property
+    @resolved_property
     def value(self) -> str:
         return self._doc['value']
 
@@ -356,7 +478,7 @@ class DocEnumField(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
-    @property
+    @resolved_property
     def value(self) -> str:
         return self._doc['value']
 
@@ -365,9 +487,9 @@ class DocStruct(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
-    @property
+    @resolved_property
     def size(self) -> int:
-        if isinstance(self._doc['size'], int):
+        if isinstance(self._doc.get('size'), int):
             return self._doc['size']
         return -1
 
@@ -376,7 +498,7 @@ class DocStructField(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
-    @property
+    @resolved_property
     def size(self) -> int:
         if isinstance(self._doc['size'], str) and self._doc['size'] == '?':
             assert self.parent                      # Must have parent
@@ -397,7 +519,7 @@ class DocBitfield(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
-    @property
+    @resolved_property
     def size(self) -> int:
         return self._doc['size']
 
@@ -406,7 +528,7 @@ class DocBitfieldField(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
-    @property
+    @resolved_property
     def bit(self) -> Tuple[int, int]:
         if isinstance(self._doc['bit'], int):
             bit_from, bit_to = self._doc['bit'], self._doc['bit'] + 1
@@ -0,0 +1,141 @@
+from typing import List, Optional, Set
+
+import concurrent.futures
+import multiprocessing
+import os
+
+from .doc import Doc, DocBase
+from .ir import DocIr
+from .options import DocProcessorOptions
+from .profile import DocProfile
+from .processors.c_processor import DocCProcessor
+from .processors.ir_processor import DocIrProcessor
+
+DOC_PROCESSORS = {
+    'c'     : DocCProcessor,
+    'ir'    : DocIrProcessor,
+}
+
+#
+# Document list parsed by the parent process. Worker processes created
+# by fork() inherit it, so the YAML files are parsed only once.
+#
+_doc_file = None
+_doc_list = None
+
+
+def _emit_in_worker(config: str, file: str, cache_directory: str, profile: bool) -> Optional[dict]:
+    global _doc_file, _doc_list
+
+    #
+    # Forked worker processes inherit measurements of the parent process,
+    # only measurements made by the worker itself are sent back.
+    #
+    DocProfile.enabled = profile
+    DocProfile.reset()
+
+    #
+    # Worker processes which were not forked (e.g. on Windows) have to parse
+    # the document list by themselves (usually from the parse cache).
+    #
+    if _doc_file != file:
+        Doc.cache_directory = cache_directory
+        _doc_file, _doc_list = file, Doc.parse(file)
+        DocIr.resolve(_doc_list)
+
+    DocGenerator.emit(config, _doc_list)
+
+    return DocProfile.collect() if profile else None
+
+
+class DocGenerator(object):
+    def __init__(self, file: str):
+        self.file = file
+        self.doc_list = Doc.parse(file)
+
+        #
+        # Resolve documents before the worker processes are forked.
+        #
+        DocIr.resolve(self.doc_list)
+
+    def run(self, config_list: List[str], jobs: int=None) -> None:
+        if jobs is None:
+            jobs = min(len(config_list), os.cpu_count() or 1)
+
+        if jobs <= 1:
+            for config in config_list:
+                DocGenerator.emit(config, self.doc_list)
+            return
+
+        global _doc_file, _doc_list
+        _doc_file, _doc_list = self.file, self.doc_list
+
+        if 'fork' in multiprocessing.get_all_start_methods():
+            context = multiprocessing.get_context('fork')
+        else:
+            context = multiprocessing.get_context()
+
+        with concurrent.futures.ProcessPoolExecutor(max_workers=jobs, mp_context=context) as executor:
+            futures = [
+                executor.submit(_emit_in_worker, config, self.file, Doc.cache_directory, DocProfile.enabled)
+                for config in config_list
+            ]
+
+            #
+            # Propagate exceptions raised in worker processes.
+            #
+            for future in futures:
+                profile = future.result()
+                if profile:
+                    DocProfile.merge(profile)
+
+    def reparse(self, path: str) -> List[DocBase]:
+        '''
+        Parses the YAML file again and replaces its documents in the tree
+        (files included by it are mapped again from the in-memory cache).
+        Returns the new documents.
+        '''
+
+        Doc.invalidate(path)
+
+        if path == self.file:
+            self.doc_list = Doc.parse(path)
+            DocIr.resolve(self.doc_list)
+            return self.doc_list
+
+        #
+        # Top-level documents of the file (grouped by the including document)
+        # are the only ones with the 'path' set explicitly.
+        #
+        old_doc_lists = { }
+
+        def find(doc: DocBase) -> None:
+            for field in doc.fields:
+                if field._doc.get('path') == path:
+                    old_doc_lists.setdefault(field.parent, []).append(field)
+                else:
+                    find(field)
+
+        for doc in self.doc_list:
+            find(doc)
+
+        result = []
+
+        for parent, old_doc_list in old_doc_lists.items():
+            new_doc_list = Doc.parse(path, parent)
+
+            index = parent.fields.index(old_doc_list[0])
+            assert parent.fields[index:index + len(old_doc_list)] == old_doc_list
+            parent.fields[index:index + len(old_doc_list)] = new_doc_list
+
+            result += new_doc_list
+
+        DocIr.resolve(self.doc_list)
+        return result
+
+    @staticmethod
+    def emit(config: str, doc_list: List[DocBase], changed_doc_set: Set[DocBase]=None) -> None:
+        options = DocProcessorOptions(file=config)
+        processor = DOC_PROCESSORS[options.processor]()
+        with processor.opt.push(options):
+            processor.run(doc_list, changed_doc_set)
@@ -0,0 +1,182 @@
+from typing import List, NamedTuple, Optional, Tuple, Union
+
+from .doc import DocBase, DocDefinition, DocEnumField, DocStruct, DocStructField, DocBitfield, DocBitfieldField
+from .profile import DocProfile
+
+
+class DocIrRecord(NamedTuple):
+    #
+    # Position of the record in DocIr.records, position of the parent record
+    # (-1 for root documents) and positions of the children records.
+    #
+    index: int
+    parent_index: int
+    field_indices: Tuple[int, ...]
+
+    type: str
+    alternative_type: str
+    path: str
+
+    short_name: str
+    long_name: str
+    alternative_name: str
+    short_name_raw: str
+    long_name_raw: str
+    short_name_standalone: str
+    long_name_standalone: str
+
+    short_description: str
+    long_description: str
+    short_description_raw: str
+    long_description_raw: str
+
+    children_name_with_prefix: str
+    children_name_with_suffix: str
+
+    note: str
+    access: str
+    todo: str
+    tag: str
+    remarks: str
+    see: Union[str, Tuple[str, ...]]
+    reference: Union[str, Tuple[str, ...]]
+
+    #
+    # Type-specific attributes (None if not applicable):
+    #   value - definition, enum_field
+    #   size  - struct, struct_field, bitfield
+    #   bit   - bitfield_field
+    #
+    value: Optional[Union[int, str]]
+    size: Optional[int]
+    bit: Optional[Tuple[int, int]]
+
+
+class DocIr(object):
+    '''
+    Resolved (flat, immutable) representation of the document tree.
+
+    Every derived attribute (names with affixes of parents, bit ranges, sizes, ...)
+    is computed exactly once. Resolved documents return the frozen values
+    from their records.
+    '''
+
+    def __init__(self, doc_list: List[DocBase]):
+        self.docs: List[DocBase] = []
+        self.root_indices: Tuple[int, ...] = ()
+
+        records = []
+        root_indices = []
+
+        for doc in doc_list:
+            root_indices.append(self._resolve(doc, -1, records))
+
+        self.records: Tuple[DocIrRecord, ...] = tuple(records)
+        self.root_indices = tuple(root_indices)
+
+        #
+        # Freeze documents.
+        #
+        for doc, record in zip(self.docs, self.records):
+            doc._record = record
+            doc._ir = self
+
+    def _resolve(self, doc: DocBase, parent_index: int, records: List[Optional[DocIrRecord]]) -> int:
+        index = len(records)
+        records.append(None)
+        self.docs.append(doc)
+
+        #
+        # Unnamed documents (e.g. bitfields) are allowed to raise when asked
+        # for their name.
+        #
+        def name(attribute: str) -> str:
+            try:
+                return getattr(doc, attribute)
+            except Exception:
+                if doc.REQUIRED_NAME:
+                    raise
+                return ''
+
+        def freeze(value):
+            return tuple(value) if isinstance(value, list) else value
+
+        value = doc.value if isinstance(doc, (DocDefinition, DocEnumField)) else None
+        size = doc.size if isinstance(doc, (DocStruct, DocStructField, DocBitfield)) else None
+        bit = doc.bit if isinstance(doc, DocBitfieldField) else None
+
+        record = dict(
+            index=index,
+            parent_index=parent_index,
+            type=doc.type,
+            alternative_type=doc.alternative_type,
+            path=doc.path,
+            short_name=name('short_name'),
+            long_name=name('long_name'),
+            alternative_name=name('alternative_name'),
+            short_name_raw=name('short_name_raw'),
+            long_name_raw=name('long_name_raw'),
+            short_name_standalone=name('short_name_standalone'),
+            long_name_standalone=name('long_name_standalone'),
+            short_description=doc.short_description,
+            long_description=doc.long_description,
+            short_description_raw=doc.short_description_raw,
+            long_description_raw=doc.long_description_raw,
+            children_name_with_prefix=name('children_name_with_prefix'),
+            children_name_with_suffix=name('children_name_with_suffix'),
+            note=doc.note,
+            access=doc.access,
+            todo=doc.todo,
+            tag=doc.tag,
+            remarks=doc.remarks,
+            see=freeze(doc.see),
+            reference=freeze(doc.reference),
+            value=value,
+            size=size,
+            bit=bit,
+        )
+
+        field_indices = [ self._resolve(field, index, records) for field in doc.fields ]
+
+        records[index] = DocIrRecord(field_indices=tuple(field_indices), **record)
+        return index
+
+    def __len__(self) -> int:
+        return len(self.records)
+
+    def parent(self, record: DocIrRecord) -> Optional[DocIrRecord]:
+        return self.records[record.parent_index] if record.parent_index >= 0 else None
+
+    def fields(self, record: DocIrRecord) -> List[DocIrRecord]:
+        return [ self.records[index] for index in record.field_indices ]
+
+    @staticmethod
+    def resolve(doc_list: List[DocBase]) -> 'DocIr':
+        #
+        # Documents are resolved only once, unless new (unresolved) documents
+        # have been added to the tree.
+        #
+        ir_set = { doc._ir for doc in doc_list if doc._record is not None }
+
+        if len(ir_set) == 1 and all(doc._record is not None for doc in doc_list):
+            ir = ir_set.pop()
+            if all(DocIr._is_resolved(doc) for doc in doc_list):
+                return ir
+
+        for doc in doc_list:
+            DocIr._unfreeze(doc)
+
+        with DocProfile.measure('resolve'):
+            return DocIr(doc_list)
+
+    @staticmethod
+    def _is_resolved(doc: DocBase) -> bool:
+        return doc._record is not None and all(DocIr._is_resolved(field) for field in doc.fields)
+
+    @staticmethod
+    def _unfreeze(doc: DocBase) -> None:
+        doc._record = None
+        doc._ir = None
+
+        for field in doc.fields:
+            DocIr._unfreeze(field)
@@ -118,11 +118,29 @@ class DocProcessorOptions(object):
         # Group category.
         #
         self.group_defgroup = True
+        self.group_as_namespace = False
+        self.group_with_lookup_table = False
 
         #
         # Definition category.
         #
         self.definition_no_indent = True
+        self.definition_as_constexpr = False
+        self.definition_as_enum = False
+        self.definition_inline_function_specifier = 'static inline'
+
+        #
+        # Bitfield category.
+        #
+        self.bitfield_with_define_defined_bits = False
+        self.bitfield_with_define_reserved_bits = False
+        self.bitfield_with_define_defined_bits_suffix = '_DEFINED_BITS'
+        self.bitfield_with_define_reserved_bits_suffix = '_RESERVED_BITS'
+        self.bitfield_with_halves = False
+        self.bitfield_with_halves_groups = [ 'MODEL_SPECIFIC_REGISTERS' ]
+        self.bitfield_with_descriptors = False
+        self.bitfield_descriptor_type_name = 'bitfield_descriptor'
+        self.bitfield_field_descriptor_type_name = 'bitfield_field_descriptor'
 
         #
         # Bitfield field category.
@@ -133,6 +151,8 @@ class DocProcessorOptions(object):
         self.bitfield_field_fill_with_reserved = True
         self.bitfield_field_reserved_prefix = 'Reserved'
         self.bitfield_field_flags_name = 'Flags'
+        self.bitfield_field_low_name = 'Low'
+        self.bitfield_field_high_name = 'High'
 
         self.bitfield_field_with_define_bit = True
         self.bitfield_field_with_define_flag = True
@@ -144,6 +164,29 @@ class DocProcessorOptions(object):
         self.bitfield_field_with_define_mask_suffix = '_MASK'
         self.bitfield_field_with_define_get_macro_argument_name = '_'
 
+        self.bitfield_field_with_define_set = False
+        self.bitfield_field_with_define_clear = False
+        self.bitfield_field_with_define_insert = False
+        self.bitfield_field_with_inline_functions = False
+        self.bitfield_field_inline_functions_only = False
+
+        self.bitfield_field_with_define_set_suffix = '_SET'
+        self.bitfield_field_with_define_clear_suffix = '_CLEAR'
+        self.bitfield_field_with_define_insert_suffix = '_INSERT'
+        self.bitfield_field_with_define_insert_macro_argument_name = 'value'
+
+        self.bitfield_field_with_define_halves = False
+        self.bitfield_field_with_define_low_suffix = '_LOW'
+        self.bitfield_field_with_define_high_suffix = '_HIGH'
+
+        self.bitfield_field_with_accessors = False
+        self.bitfield_field_accessor_get_prefix = 'get_'
+        self.bitfield_field_accessor_set_prefix = 'set_'
+        self.bitfield_field_accessor_with_prefix = 'with_'
+        self.bitfield_field_accessor_ack_prefix = 'ack_'
+        self.bitfield_field_accessor_honor_access = False
+        self.bitfield_w1c_registers = [ 'IA32_PERF_GLOBAL_STATUS_RESET' ]
+
         def bitfield_field_with_defines_getter(self_):
             return all([
                 self_.bitfield_field_with_define_bit,
@@ -163,6 +206,16 @@ class DocProcessorOptions(object):
             bitfield_field_with_defines_setter
         )
 
+        #
+        # Processor used for the output (c, ir).
+        #
+        self.processor = 'c'
+
+        #
+        # Format of the "ir" processor output (binary, json).
+        #
+        self.ir_format = 'binary'
+
         #
         # Misc.
         #
@@ -170,6 +223,30 @@ class DocProcessorOptions(object):
         self.indent = 2
         self.brace_on_next_line = True  # Bitfield / struct.
         self.enum_as_define = False
+        self.enum_with_lookup_table = False
+        self.lookup_table_type_name = 'lookup_table'
+        self.lookup_table_suffix = '_lookup'
+        self.vmcs_field_traits = False
+        self.vmcs_field_groups = [ 'VMCS_FIELDS' ]
+        self.vmcs_field_value_types = { }
+        self.vmcs_field_type_name = 'vmcs_field'
+        self.vmcs_field_backend_type_name = 'vmx_instructions'
+        self.vmcs_field_index = False
+        self.vmcs_field_cache = False
+        self.vmcs_field_cache_type_name = 'vmcs_cache'
+        self.vmcs_shadow_bitmaps = False
+        self.vmcs_shadow_bitmaps_type_name = 'vmcs_shadow_bitmaps'
+        self.vmcs_shadow_read_fields = [ ]
+        self.vmcs_shadow_write_fields = [ ]
+        self.msr_bitmap_builder = False
+        self.msr_bitmap_struct = 'VMX_MSR_BITMAP'
+        self.msr_bitmap_groups = [ 'MODEL_SPECIFIC_REGISTERS' ]
+        self.msr_bitmap_type_name = 'msr_bitmap'
+        self.msr_bitmap_group_suffix = '_msrs'
+        self.msr_bitmap_pass_through_read_msrs = [ ]
+        self.msr_bitmap_pass_through_write_msrs = [ ]
+        self.output_cpp = False
+        self.output_namespace = ''
         self.int_type_8  = 'UINT8'
         self.int_type_16 = 'UINT16'
         self.int_type_32 = 'UINT32'
@@ -179,6 +256,10 @@ class DocProcessorOptions(object):
         self.output_append = ''
         self.output_filename = 'out'
 
+        self.output_split = False
+        self.output_split_directory = ''
+        self.output_split_prepend = '#pragma once'
+
         #
         # Default letter cases.
         #
@@ -195,7 +276,7 @@ class DocProcessorOptions(object):
             file = kwargs.pop('file')
 
             with open(file) as f:
-                new_kwargs = yaml.load(f.read())
+                new_kwargs = yaml.load(f.read(), Loader=YAML_LOADER)
 
             #
             # Prefer original kwargs over config values.
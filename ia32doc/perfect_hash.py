@@ -0,0 +1,78 @@
+from typing import List, Union
+
+
+class DocPerfectHash(object):
+    '''
+    Perfect hash ("hash and displace") of names or values, which is
+    built by the generator and evaluated by the generated code:
+
+        slot = hash(key, seeds[hash(key, 0) & (size - 1)]) & (size - 1)
+        index = slots[slot]         # index + 1 of the key, 0 if the slot is empty
+
+    Keys are distributed into buckets by hash(key, 0). Starting with the largest
+    bucket, a seed which maps all keys of the bucket into free slots is searched.
+    The size of the table is the number of keys rounded up to the power of 2
+    (or the given size, which must be a power of 2).
+
+    Hash functions must match the generated code exactly (32-bit arithmetic).
+    '''
+
+    MAX_SEED = 0xFFFF
+
+    def __init__(self, keys: List[Union[str, int]], size: int=1):
+        self.size = size
+        while self.size < len(keys):
+            self.size *= 2
+
+        self.seeds = [ 0 ] * self.size
+        self.slots = [ 0 ] * self.size
+
+        hash_function = self.hash_name if keys and isinstance(keys[0], str) else self.hash_value
+        mask = self.size - 1
+
+        buckets = [ [] for _ in range(self.size) ]
+        for index, key in enumerate(keys):
+            buckets[hash_function(key, 0) & mask].append(index)
+
+        for bucket_index, bucket in sorted(enumerate(buckets), key=lambda item: -len(item[1])):
+            if not bucket:
+                break
+
+            for seed in range(1, self.MAX_SEED + 1):
+                slot_list = [ hash_function(keys[index], seed) & mask for index in bucket ]
+
+                if len(set(slot_list)) == len(slot_list) and not any(self.slots[slot] for slot in slot_list):
+                    break
+            else:
+                raise Exception(f'Cannot find perfect hash for {len(keys)} keys')
+
+            self.seeds[bucket_index] = seed
+            for index, slot in zip(bucket, slot_list):
+                self.slots[slot] = index + 1
+
+    def lookup(self, key: Union[str, int]) -> int:
+        #
+        # Returns index of the key (or -1). The same as the generated code does.
+        #
+        hash_function = self.hash_name if isinstance(key, str) else self.hash_value
+        mask = self.size - 1
+
+        return self.slots[hash_function(key, self.seeds[hash_function(key, 0) & mask]) & mask] - 1
+
+    @staticmethod
+    def hash_name(name: str, seed: int) -> int:
+        #
+        # FNV-1a with seed mixed into the offset basis.
+        #
+        result = 2166136261 ^ seed
+        for c in name.encode('utf-8'):
+            result = ((result ^ c) * 16777619) & 0xFFFFFFFF
+
+        return result ^ (result >> 16)
+
+    @staticmethod
+    def hash_value(value: int, seed: int) -> int:
+        #
+        # Multiplicative (Fibonacci) hashing, upper half of the 64-bit product.
+        #
+        return ((((value ^ seed) * 0x9E3779B97F4A7C15) & 0xFFFFFFFFFFFFFFFF) >> 32)
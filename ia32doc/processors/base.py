@@ -1,5 +1,22 @@
+from typing import Set, Union
+
+import io
+import locale
+import time
+
 from ..doc import *
+from ..ir import DocIr
 from ..options import DocProcessorOptionsStack
+from ..profile import DocProfile
+from ..text import DocText
+
+#
+# Kinds of output files (see DocProcessor.write()).
+#
+DOC_OUTPUT_SINGLE   = 'single'      # The only output file (output_split is false).
+DOC_OUTPUT_COMMON   = 'common'      # Common header included by every split header.
+DOC_OUTPUT_SPLIT    = 'split'       # Header of one group nested in the root group(s).
+DOC_OUTPUT_UMBRELLA = 'umbrella'    # Umbrella header including all split headers.
 
 
 class DocIndent(object):
@@ -36,14 +53,158 @@ class DocProcessor(object):
         self.indent = DocIndent(self.opt)
         self.last_new_line_count = 0
 
-    def run(self, doc_list: List[DocBase]) -> None:
-        from contextlib import redirect_stdout
+        #
+        # Name, kind (DOC_OUTPUT_*) and (in-memory) stream of the file currently being written.
+        #
+        self.output_filename = None
+        self.output_kind = None
+        self.output = None
 
-        with open(self.opt.output_filename, 'w') as f:
-            with redirect_stdout(f):
-                print(self.opt.output_prepend)
-                self.process(doc_list)
-                print(self.opt.output_append)
+        #
+        # All processed documents (the whole tree, even if the output is split)
+        # and their resolved representation.
+        #
+        self.doc_list = []
+        self.ir = None
+
+        #
+        # (parent, field class) -> first field of the class (see is_first_field()).
+        #
+        self._first_fields = { }
+
+    def run(self, doc_list: List[DocBase], changed_doc_set: Set[DocBase]=None) -> None:
+        #
+        # If changed_doc_set is given (set of documents nested directly in the
+        # root group(s)), only split headers of these documents are written.
+        # Single output file is always written as a whole.
+        #
+        self.doc_list = doc_list
+        self.ir = DocIr.resolve(doc_list)
+        self._first_fields = { }
+
+        if self.opt.output_split:
+            self.run_split(doc_list, changed_doc_set)
+        else:
+            self.write(self.opt.output_filename, doc_list, self.opt.output_prepend, self.opt.output_append)
+
+    def run_split(self, doc_list: List[DocBase], changed_doc_set: Set[DocBase]=None) -> None:
+        #
+        # Each named object nested directly in the root group(s) (usually a group)
+        # is written into its own header. Prepended/appended text goes into the
+        # common header, which is included by every split header. The original
+        # output file becomes an umbrella header including all of them.
+        #
+        output_name, output_extension = os.path.splitext(self.opt.output_filename)
+        directory = self.opt.output_split_directory or output_name
+        os.makedirs(directory, exist_ok=True)
+
+        common_filename = os.path.join(directory, f'common{output_extension}')
+        self.write(common_filename, [], self.opt.output_prepend, self.opt.output_append, DOC_OUTPUT_COMMON)
+
+        split_filenames = [ common_filename ]
+        loose_doc_list = []
+
+        for doc in doc_list:
+            if not isinstance(doc, DocGroup):
+                loose_doc_list.append(doc)
+                continue
+
+            for field in doc.fields:
+                if not field.short_name:
+                    loose_doc_list.append(field)
+                    continue
+
+                name = DocText.convert_case(field.long_name, 'snake_case')
+                filename = os.path.join(directory, f'{name}{output_extension}')
+                assert filename not in split_filenames
+
+                if changed_doc_set is None or field in changed_doc_set:
+                    self.write(filename, [ field ], self.make_split_prepend(filename, [ common_filename ]),
+                               kind=DOC_OUTPUT_SPLIT)
+
+                split_filenames.append(filename)
+
+        self.write(
+            self.opt.output_filename,
+            loose_doc_list,
+            self.make_split_prepend(self.opt.output_filename, split_filenames),
+            kind=DOC_OUTPUT_UMBRELLA
+        )
+
+    def write(self, filename: str, doc_list: List[DocBase], prepend: str='', append: str='',
+              kind: str=DOC_OUTPUT_SINGLE) -> None:
+        start = time.perf_counter()
+
+        with DocProfile.measure('emit', filename):
+            self.output_filename = filename
+            self.output_kind = kind
+            self.output = io.StringIO()
+            print(prepend, file=self.output)
+            self.print_output_begin(doc_list)
+            self.process(doc_list)
+            self.print_output_end(doc_list)
+            print(append, file=self.output)
+            content = self.write_if_changed(filename, self.output.getvalue())
+            self.output_filename = None
+            self.output_kind = None
+            self.output = None
+
+        DocProfile.add_output(filename, content, time.perf_counter() - start)
+
+    @staticmethod
+    def write_if_changed(filename: str, content: Union[str, bytes], encoding: str=None) -> bytes:
+        #
+        # Output files are replaced only if their content differs, so that
+        # their modification time (and thus everything depending on them
+        # in incremental builds) stays untouched. Text is encoded the same
+        # way as if it was written by open(filename, 'w').
+        #
+        if isinstance(content, str):
+            if os.linesep != '\n':
+                content = content.replace('\n', os.linesep)
+
+            content = content.encode(encoding or locale.getpreferredencoding(False))
+
+        try:
+            with open(filename, 'rb') as f:
+                if f.read() == content:
+                    return content
+        except OSError:
+            pass
+
+        #
+        # Write into temporary file first, so that readers never see
+        # partially written output.
+        #
+        filename_temporary = f'{filename}.{os.getpid()}.tmp'
+
+        with open(filename_temporary, 'wb') as f:
+            f.write(content)
+
+        os.replace(filename_temporary, filename)
+
+        return content
+
+    def is_first_field(self, doc: DocBase, field_class: type) -> bool:
+        #
+        # Looking up the first field for every field would be quadratic
+        # in the number of fields of the parent.
+        #
+        key = (doc.parent, field_class)
+
+        if key not in self._first_fields:
+            self._first_fields[key] = next(filter(lambda field: isinstance(field, field_class), doc.parent.fields))
+
+        return self._first_fields[key] is doc
+
+    def make_split_prepend(self, filename: str, include_filenames: List[str]) -> str:
+        result = self.opt.output_split_prepend.rstrip() + '\n'
+
+        for include_filename in include_filenames:
+            include_path = os.path.relpath(include_filename, os.path.dirname(filename)).replace(os.sep, '/')
+            result += f'#include "{include_path}"\n'
+
+        return result
 
     def print(self, text: str) -> None:
         if text:
@@ -52,28 +213,42 @@ class DocProcessor(object):
                     if line.startswith('#') and self.opt.definition_no_indent and self.indent.indent > 0:
                         keyword = re.match(r'(#\w*)\s*(.*)', line).group(1)
                         line = re.sub(r'(#\w*)\s*(.*)', rf'\1{self.indent(keyword)}\2', line)
-                        print(f'{self._fix_text(line)}')
+                        print(f'{self._fix_text(line)}', file=self.output)
                     else:
-                        print(f'{self.indent}{self._fix_text(line)}')
+                        print(f'{self.indent}{self._fix_text(line)}', file=self.output)
 
                     self.last_new_line_count = 0
                 else:
                     #
                     # Empty line? Just print new line.
                     #
-                    print()
+                    print(file=self.output)
                     self.last_new_line_count += 1
         else:
             #
             # Empty text? Just print new line.
             #
-            print()
+            print(file=self.output)
             self.last_new_line_count += 1
 
+    def print_output_begin(self, doc_list: List[DocBase]) -> None:
+        pass
+
+    def print_output_end(self, doc_list: List[DocBase]) -> None:
+        pass
+
     def process(self, doc_list: List[DocBase]) -> None:
         for doc in doc_list:
             assert doc.type in [ DOC_GROUP, DOC_DEFINITION, DOC_ENUM, DOC_STRUCT, DOC_BITFIELD ]
-            getattr(self, f'process_{doc.type}')(doc)
+
+            #
+            # Emit time is measured per group nested directly in the root group(s).
+            #
+            if DocProfile.enabled and doc.type == DOC_GROUP and doc.parent and not doc.parent.parent:
+                with DocProfile.measure('emit', f'{self.output_filename}:{doc.long_name}'):
+                    getattr(self, f'process_{doc.type}')(doc)
+            else:
+                getattr(self, f'process_{doc.type}')(doc)
 
     def process_group(self, doc: DocGroup) -> None:
         pass
@@ -1,10 +1,13 @@
-from typing import Union, Tuple
+from typing import List, Union, Tuple
 
-from .base import DocProcessor
+import re
+
+from .base import DocProcessor, DOC_OUTPUT_SINGLE, DOC_OUTPUT_COMMON, DOC_OUTPUT_UMBRELLA
 
 from ..doc import DocBase, DocGroup, DocDefinition, DocEnum, DocEnumField,\
                   DocBitfield, DocBitfieldField, DocStruct, DocStructField
 from ..doc import DOC_DEFINITION, DOC_STRUCT, DOC_BITFIELD, DOC_STRUCT_FIELD, DOC_ENUM_FIELD
+from ..perfect_hash import DocPerfectHash
 from ..text import DocText
 
 
@@ -28,9 +31,156 @@ class DocCProcessor(DocProcessor):
         self._bitfield_reserved_count = None
 
         #
-        # Make C++ code.
+        # Definitions postponed until the end of the root-level typedef
+        # (constexpr definitions cannot be declared inside of unions/structs).
+        #
+        self._deferred_definitions = []
+
+        #
+        # Values of already printed constexpr definitions. Unlike macros, identical
+        # constexpr definitions cannot be repeated.
+        #
+        self._constexpr_definitions = {}
+
+        #
+        # Names and values of enum constants (see definition_as_enum) not printed yet.
+        # Consecutive constants (e.g. of one group or of one bitfield) are printed
+        # as a single enum, which is closed by any other output.
+        #
+        self._enum_definitions = []
+
+        #
+        # Descriptors postponed until the end of the output (see group_as_namespace).
+        #
+        self._deferred_descriptors = []
+
+        #
+        # VMCS fields and root-level bitfields of the whole tree (keyed by long name),
+        # VMCS field traits are printed at the end of the output (see vmcs_field_traits).
+        #
+        self._vmcs_fields = []
+        self._bitfields = {}
+
+        #
+        # MSR addresses and the MSR bitmap struct of the whole tree, MSR bitmap
+        # builder is printed at the end of the output (see msr_bitmap_builder).
+        #
+        self._msrs = []
+        self._msr_bitmap = None
+
+    def print_output_begin(self, doc_list: List[DocBase]) -> None:
+        #
+        # Constexpr definitions are tracked per output file (see split_output).
+        #
+        self._constexpr_definitions = {}
+
+        if self.output_kind in [ DOC_OUTPUT_SINGLE, DOC_OUTPUT_UMBRELLA ]:
+            self.collect_model(self.doc_list)
+
+        #
+        # Wrap documents into namespace (C++ only).
+        #
+        if self.has_output_namespace(doc_list):
+            optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+
+            self.print(f'namespace {self.opt.output_namespace}{optional_curly_brace}')
+            if self.opt.brace_on_next_line:
+                self.print(f'{{')
+            self.print(f'')
+
+        if self.has_output_prologue():
+            if self.opt.bitfield_with_descriptors:
+                self.print_bitfield_descriptor_types()
+
+            if self.opt.group_with_lookup_table or self.opt.enum_with_lookup_table:
+                self.print_lookup_table_type()
+
+    def print_output_end(self, doc_list: List[DocBase]) -> None:
+        self.flush_enum_definitions()
+
+        if self._deferred_descriptors:
+            deferred_descriptors, self._deferred_descriptors = self._deferred_descriptors, []
+            for deferred_descriptor in deferred_descriptors:
+                deferred_descriptor()
+
+            self.print(f'')
+
+        if self._vmcs_fields:
+            self.print_vmcs_field_traits()
+            self.print(f'')
+
+            if self.opt.vmcs_field_index or self.opt.vmcs_field_cache or self.opt.vmcs_shadow_bitmaps:
+                self.print_vmcs_field_index()
+                self.print(f'')
+
+            if self.opt.vmcs_field_cache:
+                self.print_vmcs_field_cache()
+                self.print(f'')
+
+            if self.opt.vmcs_shadow_bitmaps:
+                self.print_vmcs_shadow_bitmaps()
+                self.print(f'')
+
+        if self._msr_bitmap:
+            self.print_msr_bitmap()
+            self.print(f'')
+
+        has_output_namespace = self.has_output_namespace(doc_list)
+
+        self._vmcs_fields = []
+        self._bitfields = {}
+        self._msrs = []
+        self._msr_bitmap = None
+
+        if has_output_namespace:
+            self.print(f'}} // namespace {self.opt.output_namespace}')
+
+    def collect_model(self, doc_list: List[DocBase], root_level: bool=True) -> None:
+        #
+        # VMCS field traits/cache/shadow bitmaps and the MSR bitmap builder refer to
+        # documents all over the tree (e.g. VMCS_GUEST_CR0 -> CR0, MSR addresses in
+        # many groups), which are in different headers when the output is split.
+        # Therefore they are collected from the whole tree and printed only into
+        # outputs which see all of it (single output or the umbrella header).
+        #
+        for doc in doc_list:
+            if self.is_vmcs_field(doc):
+                self._vmcs_fields.append(doc)
+
+            if self.is_msr(doc):
+                self._msrs.append(doc)
+
+            if isinstance(doc, DocBitfield) and root_level and (doc.short_name or doc.long_name):
+                self._bitfields[doc.long_name] = doc
+
+            if isinstance(doc, DocStruct) and self.opt.output_cpp and self.opt.msr_bitmap_builder and \
+               doc.long_name_raw == self.opt.msr_bitmap_struct:
+                self._msr_bitmap = doc
+
+            self.collect_model(doc.fields, root_level and not isinstance(doc, (DocStruct, DocBitfield)))
+
+    def has_output_prologue(self) -> bool:
+        #
+        # Types shared by all documents are printed only once, i.e. into the
+        # common header (included by every split header) when the output is split.
         #
-        self._output_cpp = False
+        if not self.opt.output_cpp:
+            return False
+
+        if not any([
+            self.opt.bitfield_with_descriptors,
+            self.opt.group_with_lookup_table,
+            self.opt.enum_with_lookup_table
+        ]):
+            return False
+
+        return self.output_kind in [ DOC_OUTPUT_SINGLE, DOC_OUTPUT_COMMON ]
+
+    def has_output_namespace(self, doc_list: List[DocBase]) -> bool:
+        if not self.opt.output_cpp or not self.opt.output_namespace:
+            return False
+
+        return bool(doc_list) or self.has_output_prologue() or bool(self._vmcs_fields or self._msr_bitmap)
 
     def process_group(self, doc: DocGroup) -> None:
         if self.opt.group_comments and doc.long_description or self.opt.group_defgroup:
@@ -41,8 +191,32 @@ class DocCProcessor(DocProcessor):
                 self.print(f' * @{{')
             self.print(f' */')
 
+        #
+        # Wrap nested groups into inline namespaces (C++ only), so that their content
+        # is accessible both with (e.g. ia32::control_registers::cr0) and without
+        # (e.g. ia32::cr0) the name of the group. Root groups are represented by
+        # output_namespace, unnamed groups (e.g. with just a prefix) are skipped.
+        #
+        name = self.make_name(doc, override_name_letter_case='snake_case')
+        print_namespace = self.opt.output_cpp and self.opt.group_as_namespace and doc.parent and name
+
+        if print_namespace:
+            optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+
+            self.print(f'inline namespace {name}{optional_curly_brace}')
+            if self.opt.brace_on_next_line:
+                self.print(f'{{')
+            self.print(f'')
+
         self.process(doc.fields)
 
+        if self.opt.output_cpp and self.opt.group_with_lookup_table:
+            self.print_lookup_table(doc)
+
+        if print_namespace:
+            self.print(f'}} // namespace {name}')
+            self.print(f'')
+
         if self.opt.group_defgroup:
             self.print(f'/**')
             self.print(f' * @}}')
@@ -51,6 +225,10 @@ class DocCProcessor(DocProcessor):
         self.print(f'')
 
     def process_definition(self, doc: DocDefinition) -> None:
+        if (self.opt.definition_as_constexpr or self.opt.definition_as_enum) and self._typedef_nesting > 0:
+            self._deferred_definitions.append(lambda: self.process_definition(doc))
+            return
+
         #
         # We need to set "override_name_letter_case" explicitly,
         # because this method is also shared for DocEnumField.
@@ -61,19 +239,16 @@ class DocCProcessor(DocProcessor):
             #
             # Do not print empty line for the first element.
             #
-            if next(filter(lambda field: isinstance(field, DocDefinition), doc.parent.fields)) != doc:
+            if not self.is_first_field(doc, DocDefinition):
                 self.print(f'')
             self.print(f'/**')
             self.print_details(doc)
             self.print(f' */')
 
-        align = self.opt.align if self.opt.definition_no_indent else \
-                self.align_indent_adjusted
-
         value = f'0x{doc.value:08X}' if isinstance(doc.value, int) else \
                 f'{doc.value}'
 
-        self.print(f'#define {name:<{align}} {value}')
+        self.print_definition(name, value)
 
         self.process(doc.fields)
 
@@ -117,7 +292,7 @@ class DocCProcessor(DocProcessor):
             optional_name_begin = ''
             optional_name_end = ''
 
-            if self._output_cpp:
+            if self.opt.output_cpp:
                 optional_name_begin = f' {self.make_name(doc)}'
             else:
                 optional_typedef = 'typedef ' if self._typedef_nesting == 1 else ''
@@ -143,6 +318,10 @@ class DocCProcessor(DocProcessor):
                 self.print(f'}} {name};')
 
             self._typedef_nesting -= 1
+            self.flush_deferred_definitions()
+
+        if self.opt.output_cpp and self.opt.enum_with_lookup_table:
+            self.print_lookup_table(doc)
 
         self.print(f'')
 
@@ -153,7 +332,7 @@ class DocCProcessor(DocProcessor):
             #
             # Do not print empty line for the first element.
             #
-            if next(filter(lambda field: isinstance(field, DocEnumField), doc.parent.fields)) != doc:
+            if not self.is_first_field(doc, DocEnumField):
                 self.print(f'')
             self.print(f'/**')
             self.print_details(doc)
@@ -182,7 +361,7 @@ class DocCProcessor(DocProcessor):
         optional_name_begin = ''
         optional_name_end = ''
 
-        if self._output_cpp:
+        if self.opt.output_cpp:
             optional_name_begin = f' {self.make_name(doc)}'
         else:
             optional_typedef = 'typedef ' if self._typedef_nesting == 1 else ''
@@ -194,10 +373,17 @@ class DocCProcessor(DocProcessor):
 
         with self.indent:
             for field in doc.fields:
-                assert field.type in [ DOC_STRUCT, DOC_BITFIELD, DOC_STRUCT_FIELD ]
+                assert field.type in [ DOC_DEFINITION, DOC_STRUCT, DOC_BITFIELD, DOC_STRUCT_FIELD ]
 
                 if isinstance(field, DocBitfield) and not self.opt.bitfield_create_struct:
-                    self.print(f'{self.make_size_type(field.size)[0]} {self.make_name(field, standalone=True)};')
+                    #
+                    # Bitfields without standalone name (e.g. with just a prefix for their
+                    # fields) become the "Flags" member. Definitions of their fields
+                    # are still printed.
+                    #
+                    name = self.make_name(field, standalone=True) or self.opt.bitfield_field_flags_name
+                    self.print(f'{self.make_size_type(field.size)[0]} {name};')
+                    self.process_bitfield(field)
                 else:
                     getattr(self, f'process_{field.type}')(field)
 
@@ -218,9 +404,10 @@ class DocCProcessor(DocProcessor):
         if doc.tag == 'Packed':
             self.print(f'#pragma pack(pop)')
 
-        self.print(f'')
-
         self._typedef_nesting -= 1
+        self.flush_deferred_definitions()
+
+        self.print(f'')
 
     def process_struct_field(self, doc: DocStructField) -> None:
         if self.opt.struct_field_comments and doc.long_description:
@@ -261,7 +448,7 @@ class DocCProcessor(DocProcessor):
             if self._typedef_nesting == 1:
                 assert has_name
 
-            if self._output_cpp:
+            if self.opt.output_cpp:
                 optional_name_begin = f' {self.make_name(doc)}'
             else:
                 optional_typedef = 'typedef ' if self._typedef_nesting == 1 else ''
@@ -280,7 +467,18 @@ class DocCProcessor(DocProcessor):
                 #
                 self.indent.indent_next = 0
 
+            #
+            # Accessors are implemented over the "Flags" member, which must be
+            # the first member of the union (so it is the active member in
+            # constant expressions and it can be aggregate-initialized).
+            #
+            print_accessors = has_name and self.opt.output_cpp and self.opt.bitfield_field_with_accessors
+
             with self.indent:
+                if print_accessors:
+                    self.print(f'{self.make_size_type(doc.size)[0]} {self.opt.bitfield_field_flags_name};')
+                    self.print(f'')
+
                 self.print(f'struct{optional_curly_brace}')
                 if self.opt.brace_on_next_line:
                     self.print(f'{{')
@@ -315,10 +513,27 @@ class DocCProcessor(DocProcessor):
 
                 self.print(f'}};')
 
+                #
+                # Print 32-bit view of both halves of the bitfield (only for named bitfields).
+                #
+                if self.is_bitfield_with_halves(doc):
+                    self.print(f'')
+                    self.print(f'struct{optional_curly_brace}')
+                    if self.opt.brace_on_next_line:
+                        self.print(f'{{')
+
+                    with self.indent:
+                        self.print(f'{self.opt.int_type_32} {self.opt.bitfield_field_low_name};')
+                        self.print(f'{self.opt.int_type_32} {self.opt.bitfield_field_high_name};')
+
+                    self.print(f'}};')
+
                 #
                 # Print "Flags" member (only for named bitfields).
                 #
-                if has_name:
+                if print_accessors:
+                    self.print_bitfield_accessors(doc)
+                elif has_name:
                     self.print(f'')
                     self.print(f'{self.make_size_type(doc.size)[0]} {self.opt.bitfield_field_flags_name};')
 
@@ -337,6 +552,17 @@ class DocCProcessor(DocProcessor):
                     self.print(f'}} {name};')
 
             self._typedef_nesting -= 1
+            self.flush_deferred_definitions()
+
+            if has_name and self._typedef_nesting == 0 and self.opt.output_cpp and self.opt.bitfield_with_descriptors:
+                #
+                # Specializations cannot be declared in (inline) namespaces nested in
+                # the namespace of the template, print them at the end of the output.
+                #
+                if self.opt.group_as_namespace:
+                    self._deferred_descriptors.append(lambda: self.print_bitfield_descriptor(doc))
+                else:
+                    self.print_bitfield_descriptor(doc)
         else:
             #
             # Do not create unions.
@@ -345,6 +571,8 @@ class DocCProcessor(DocProcessor):
                 if isinstance(field, DocBitfieldField):
                     self.process_bitfield_field(field)
 
+        self.print_bitfield_masks(doc)
+
         self.print(f'')
 
     def process_bitfield_field(self, doc: DocBitfieldField) -> None:
@@ -398,109 +626,109 @@ class DocCProcessor(DocProcessor):
                 self.opt.bitfield_field_with_define_get
             ])
 
+            bitfield_field_with_define_any = bitfield_field_with_define_any or any([
+                self.opt.bitfield_field_with_define_set,
+                self.opt.bitfield_field_with_define_clear,
+                self.opt.bitfield_field_with_define_insert
+            ])
+
             if bitfield_field_with_define_any:
-                part1 = self.make_name(doc.parent, override_name_letter_case=self.opt.definition_name_letter_case)
+                part1 = self.make_bitfield_definition_name(doc.parent)
                 part2 = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
-                align = self.opt.align if self.opt.definition_no_indent else \
-                        self.align_indent_adjusted
-
-                #
-                # !!! INCREDIBLY UGLY HACK !!!
-                # Remove _REGISTER suffix.
-                #
-                if 'name_with_suffix' in doc.parent._doc:
-                    part1 = part1[0:(len(part1) - len(doc.parent._doc['name_with_suffix']) - 1)]
 
             if self.opt.bitfield_field_with_define_bit:
                 definition = f'{part1}_{part2}{self.opt.bitfield_field_with_define_bit_suffix}'
-                self.print(f'#define {definition:<{align}} {bit_from}')
+                self.print_definition(definition, f'{bit_from}')
 
             if self.opt.bitfield_field_with_define_flag:
                 definition = f'{part1}_{part2}{self.opt.bitfield_field_with_define_flag_suffix}'
-                self.print(f'#define {definition:<{align}} 0x{(((1 << bit_shift) - 1) << bit_from):02X}')
+                self.print_definition(definition, f'0x{(((1 << bit_shift) - 1) << bit_from):02X}')
 
             if self.opt.bitfield_field_with_define_mask:
                 definition = f'{part1}_{part2}{self.opt.bitfield_field_with_define_mask_suffix}'
-                self.print(f'#define {definition:<{align}} 0x{((1 << bit_shift) - 1):02X}')
-
-            if self.opt.bitfield_field_with_define_get:
-                definition = f'{part1}_{part2}({self.opt.bitfield_field_with_define_get_macro_argument_name})'
-                self.print(
-                    f'#define {definition:<{align}} '
-                    f'((({self.opt.bitfield_field_with_define_get_macro_argument_name}) >> {bit_from}) & '
-                    f'0x{((1 << bit_shift) - 1):02X})'
-                )
-
-        self._bitfield_position = bit_to
+                self.print_definition(definition, f'0x{((1 << bit_shift) - 1):02X}')
 
-        self.process(doc.fields)
-
-    def process_struct(self, doc: DocStruct) -> None:
-        self._typedef_nesting += 1
-
-        if self.opt.struct_comments and doc.long_description:
-            self.print(f'/**')
-            self.print_details(doc, treat_description_as_short=True)
-            self.print(f' */')
-
-        if doc.tag == 'Packed':
-            self.print(f'#pragma pack(push, 1)')
+            #
+            # Getter and writers are printed over the whole bitfield and, for bitfields
+            # with halves, also over the 32-bit half containing the field (casts make sure
+            # that masks of high bits are not truncated and that values are not shifted
+            # out of int).
+            #
+            view_list = [ ('', bit_from, self.make_size_type(doc.parent.size)[0]) ]
 
-        has_name = doc.short_name or doc.long_name
-        optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
-        optional_typedef = 'typedef ' if self._typedef_nesting == 1 else ''
+            if self.opt.bitfield_field_with_define_halves and self.is_bitfield_with_halves(doc.parent):
+                if bit_to <= 32:
+                    view_list.append((self.opt.bitfield_field_with_define_low_suffix, bit_from, self.opt.int_type_32))
+                elif bit_from >= 32:
+                    view_list.append((self.opt.bitfield_field_with_define_high_suffix, bit_from - 32, self.opt.int_type_32))
 
-        self.print(f'{optional_typedef}struct{optional_curly_brace}')
-        if self.opt.brace_on_next_line:
-            self.print(f'{{')
+            argument = self.opt.bitfield_field_with_define_get_macro_argument_name
+            value_argument = self.opt.bitfield_field_with_define_insert_macro_argument_name
+            mask = f'0x{((1 << bit_shift) - 1):02X}'
 
-        with self.indent:
-            for field in doc.fields:
-                assert field.type in [ DOC_DEFINITION, DOC_STRUCT, DOC_BITFIELD, DOC_STRUCT_FIELD ]
+            #
+            # With bitfield_field_inline_functions_only, the getter and writers are printed
+            # only as static inline functions (named in lower case).
+            #
+            inline_functions_only = self.opt.bitfield_field_inline_functions_only and \
+                                    not self.opt.definition_as_constexpr
+
+            for suffix, view_bit_from, size_type in view_list:
+                getter_list = []
+
+                if self.opt.bitfield_field_with_define_get:
+                    getter_list.append((
+                        f'{part1}_{part2}{suffix}',
+                        f'((({argument}) >> {view_bit_from}) & {mask})',
+                        [ argument ]
+                    ))
+
+                flag = f'(({size_type})0x{(((1 << bit_shift) - 1) << view_bit_from):02X})'
+
+                writer_list = []
+
+                if self.opt.bitfield_field_with_define_set:
+                    writer_list.append((
+                        f'{part1}_{part2}{suffix}{self.opt.bitfield_field_with_define_set_suffix}',
+                        f'(({argument}) | {flag})',
+                        [ argument ]
+                    ))
+
+                if self.opt.bitfield_field_with_define_clear:
+                    writer_list.append((
+                        f'{part1}_{part2}{suffix}{self.opt.bitfield_field_with_define_clear_suffix}',
+                        f'(({argument}) & ~{flag})',
+                        [ argument ]
+                    ))
+
+                if self.opt.bitfield_field_with_define_insert:
+                    writer_list.append((
+                        f'{part1}_{part2}{suffix}{self.opt.bitfield_field_with_define_insert_suffix}',
+                        f'((({argument}) & ~{flag}) | ((({size_type})({value_argument}) & {mask}) << {view_bit_from}))',
+                        [ argument, value_argument ]
+                    ))
+
+                if not inline_functions_only:
+                    for definition, value, argument_list in getter_list + writer_list:
+                        self.print_definition(definition, value, argument_list, size_type)
 
-                if isinstance(field, DocBitfield) and not self.opt.bitfield_create_struct:
-                    self.print(f'{self.make_size_type(field.size)[0]} {self.make_name(field, standalone=True)};')
+                #
+                # Matching static inline functions (named in lower case), which are
+                # type-checked and evaluate their arguments only once.
+                #
+                if inline_functions_only:
+                    function_list = getter_list + writer_list
+                elif self.opt.bitfield_field_with_inline_functions and not self.opt.definition_as_constexpr:
+                    function_list = writer_list
                 else:
-                    getattr(self, f'process_{field.type}')(field)
-
-        if self._typedef_nesting == 1:
-            assert has_name
-            self.print(f'}} {self.make_name(doc)};')
-        else:
-            if has_name:
-                name = self.make_name(
-                    doc,
-                    standalone=True,
-                    override_name_letter_case=self.opt.struct_field_name_letter_case
-                )
-                self.print(f'}} {name};')
-            else:
-                self.print(f'}};')
+                    function_list = []
 
-        if doc.tag == 'Packed':
-            self.print(f'#pragma pack(pop)')
-
-        self.print(f'')
-
-        self._typedef_nesting -= 1
-
-    def process_struct_field(self, doc: DocStructField) -> None:
-        if self.opt.struct_field_comments and doc.long_description:
-            #
-            # Do not print empty line for the first element.
-            #
-            if next(iter(doc.parent.fields)) != doc:
-                self.print(f'')
-            self.print(f'/**')
-            self.print_details(doc)
-            self.print(f' */')
+                for definition, value, argument_list in function_list:
+                    self.print_definition(definition.lower(), value, argument_list, size_type, static_inline=True)
 
-        size_type, size_type_array = self.make_size_type(doc.size)
-        self.print(f'{size_type} {self.make_name(doc)}{size_type_array};')
+        self._bitfield_position = bit_to
 
-        if doc.fields:
-            self.print(f'')
-            self.process(doc.fields)
+        self.process(doc.fields)
 
     #                                                                                                                  #
     # ================================================================================================================ #
@@ -592,43 +820,1360 @@ class DocCProcessor(DocProcessor):
         # see and reference can be either list (of strings) or string.
         #
         if print_see:
-            if isinstance(doc.see, list):
+            if isinstance(doc.see, (list, tuple)):
                 for see in doc.see:
                     self.print(f' * @see {see}')
             else:
                 self.print(f' * @see {doc.see}')
 
         if print_reference:
-            if isinstance(doc.reference, list):
+            if isinstance(doc.reference, (list, tuple)):
                 for reference in doc.reference:
                     self.print(f' * @see {reference} (reference)')
             else:
                 self.print(f' * @see {doc.reference} (reference)')
 
-    def make_name(self, doc: DocBase,
-                  long: bool=None, raw: bool=False, standalone: bool=False,
-                  override_name_letter_case: str=None) -> str:
-        assert not (raw and standalone)  # invalid combination
+    def print_definition(self, name: str, value: str, argument: Union[str, List[str]]=None, argument_type: str=None,
+                         static_inline: bool=False) -> None:
+        #
+        # Definitions with argument(s) are printed as macros, constexpr functions
+        # (definition_as_constexpr) or static inline functions (static_inline).
+        #
+        align = self.opt.align if self.opt.definition_no_indent else \
+                self.align_indent_adjusted
 
-        if long is None:
-            long = getattr(self.opt, f'{doc.type}_prefer_long_names')
+        argument_list = [ argument ] if isinstance(argument, str) else argument
 
-        if getattr(self.opt, f'{doc.type}_prefer_alternative_names') and doc.alternative_name:
-            result = doc.alternative_name
+        #
+        # Constants are printed as enum constants (definition_as_enum) only if
+        # they fit into int, other ones stay macros.
+        #
+        as_enum = self.opt.definition_as_enum and not self.opt.definition_as_constexpr and \
+                  argument_list is None and self.is_int_constant(value)
+
+        if not self.opt.definition_as_constexpr and not static_inline and not as_enum:
+            if argument_list is not None:
+                name = f'{name}({", ".join(argument_list)})'
+
+            self.print(f'#define {name:<{align}} {value}')
+        elif self._typedef_nesting > 0:
+            self._deferred_definitions.append(
+                lambda: self.print_definition(name, value, argument, argument_type, static_inline)
+            )
         else:
-            if raw:
-                result = doc.long_name_raw if long else doc.short_name_raw
-            elif standalone:
-                result = doc.long_name_standalone if long else doc.short_name_standalone
+            if name in self._constexpr_definitions:
+                assert self._constexpr_definitions[name] == value
+                return
+
+            self._constexpr_definitions[name] = value
+
+            if as_enum:
+                self._enum_definitions.append((name, value, align))
+                return
+
+            #
+            # Keep values of constants and bodies of functions aligned.
+            #
+            prefix = f'inline constexpr {self.opt.int_type_64} '
+            align += len(prefix)
+
+            if argument_list is not None:
+                function = self.opt.definition_inline_function_specifier if static_inline else 'constexpr'
+                argument_list = ', '.join([ f'const {argument_type} {argument}' for argument in argument_list ])
+
+                definition = f'{function} {argument_type} {name}({argument_list})'
+                self.print(f'{definition:<{align}} {{ return {value}; }}')
             else:
-                result = doc.long_name if long else doc.short_name
+                definition = f'{prefix}{name}'
+                self.print(f'{definition:<{align}} = {value};')
 
-        if override_name_letter_case is not None:
-            letter_case = override_name_letter_case
-        else:
-            letter_case = getattr(self.opt, f'{doc.type}_name_letter_case')
+    def flush_enum_definitions(self) -> None:
+        #
+        # Print pending enum constants as a single enum, e.g.:
+        #
+        #   enum {
+        #     CR0_PROTECTION_ENABLE                                  = 0x01,
+        #     CR0_MONITOR_COPROCESSOR                                = 0x02,
+        #   };
+        #
+        if not self._enum_definitions:
+            return
 
-        return DocText.convert_case(result, letter_case)
+        enum_definitions, self._enum_definitions = self._enum_definitions, []
+
+        if len(enum_definitions) == 1:
+            name, value, align = enum_definitions[0]
+            definition = f'enum {{ {name}'
+            self.print(f'{definition:<{align + len("enum { ")}} = {value} }};')
+            return
+
+        self.print_block('enum', [
+            f'{name:<{align}} = {value},' for name, value, align in enum_definitions
+        ], end='};')
+
+    def print(self, text: str) -> None:
+        #
+        # Any other output closes the pending enum (see flush_enum_definitions()).
+        #
+        self.flush_enum_definitions()
+        super().print(text)
+
+    @staticmethod
+    def is_int_constant(value: str) -> bool:
+        try:
+            return 0 <= int(value, 0) <= 0x7FFFFFFF
+        except ValueError:
+            return False
+
+    def flush_deferred_definitions(self) -> None:
+        #
+        # Print definitions postponed by print_definition() once we're back
+        # at the root level.
+        #
+        if self._typedef_nesting == 0 and self._deferred_definitions:
+            self.print(f'')
+
+            deferred_definitions, self._deferred_definitions = self._deferred_definitions, []
+            for deferred_definition in deferred_definitions:
+                deferred_definition()
+
+    def print_bitfield_masks(self, doc: DocBitfield) -> None:
+        #
+        # Print masks of all defined and all reserved bits of the bitfield, so
+        # that e.g. reserved bits of a value can be checked with single AND:
+        #
+        #   #define CR0_DEFINED_BITS                                 0xE005003F
+        #   #define CR0_RESERVED_BITS                                0xFFFFFFFF1FFAFFC0
+        #
+        # Fields named "Reserved" count as reserved bits. Masks are printed only
+        # for named bitfields which are not nested in structs/bitfields (names of
+        # nested bitfields, e.g. CPUID_EDX, are not unique).
+        #
+        if not self.opt.bitfield_with_define_defined_bits and not self.opt.bitfield_with_define_reserved_bits:
+            return
+
+        if not (doc.short_name or doc.long_name) or isinstance(doc.parent, (DocStruct, DocBitfield)):
+            return
+
+        defined_bits = 0
+
+        for field in doc.fields:
+            if isinstance(field, DocBitfieldField) and not re.match(r'^RESERVED\d*$', field.long_name.upper()):
+                bit_from, bit_to = field.bit
+                defined_bits |= ((1 << (bit_to - bit_from)) - 1) << bit_from
+
+        reserved_bits = ((1 << doc.size) - 1) & ~defined_bits
+        name = self.make_bitfield_definition_name(doc)
+
+        if self.opt.bitfield_with_define_defined_bits:
+            self.print_definition(f'{name}{self.opt.bitfield_with_define_defined_bits_suffix}', f'0x{defined_bits:02X}')
+
+        if self.opt.bitfield_with_define_reserved_bits:
+            self.print_definition(f'{name}{self.opt.bitfield_with_define_reserved_bits_suffix}', f'0x{reserved_bits:02X}')
+
+    def is_bitfield_with_halves(self, doc: DocBitfield) -> bool:
+        #
+        # Named 64-bit bitfields at the root level (i.e. not nested in struct/bitfield)
+        # nested in any of bitfield_with_halves_groups (or all of them, if empty).
+        #
+        if not self.opt.bitfield_with_halves or doc.size != 64:
+            return False
+
+        if not (doc.short_name or doc.long_name) or isinstance(doc.parent, (DocStruct, DocBitfield)):
+            return False
+
+        if not self.opt.bitfield_with_halves_groups:
+            return True
+
+        parent = doc.parent
+        while parent:
+            if isinstance(parent, DocGroup) and parent.long_name_raw in self.opt.bitfield_with_halves_groups:
+                return True
+
+            parent = parent.parent
+
+        return False
+
+    def print_bitfield_accessors(self, doc: DocBitfield) -> None:
+        #
+        # Print constexpr accessors of each bitfield field, e.g.:
+        #
+        #   constexpr uint64_t get_protection_enable() const       { return ...; }
+        #   constexpr void set_protection_enable(const uint64_t _) { flags = ...; }
+        #   [[nodiscard]] constexpr cr0 with_protection_enable(const uint64_t _) const { return cr0{ ... }; }
+        #
+        # Each of them compiles into a single shift and mask of the "Flags" member.
+        # Chained with_* calls (cr0{}.with_protection_enable(1).with_paging_enable(1))
+        # fold into a single immediate for constant arguments.
+        #
+        # With bitfield_field_accessor_honor_access, the access of the field (see
+        # make_access()) limits the accessors:
+        #   ro  - only get_*
+        #   wo  - only set_*/with_*
+        #   w1c - get_* and static ack_*, which returns value with just this field set
+        #         (i.e. without the read-modify-write, which would clear all other
+        #         pending bits); ack_* of multi-bit fields takes bits of the field to
+        #         clear (all of them by default, e.g. ack_clear_ovf_pmcn(1 << n) clears
+        #         just the bit of PMCn); static ack(bits) limits bits to the W1C fields
+        #   wc0 - get_* and ack_*, which clears just this field in the read value
+        #   rwo - the same as rw (write-once fields are told apart by descriptors)
+        #
+        size_type = self.make_size_type(doc.size)[0]
+        type_name = self.make_name(doc)
+        flags = self.opt.bitfield_field_flags_name
+        argument = self.opt.bitfield_field_with_define_get_macro_argument_name
+        align = self.align_indent_adjusted
+
+        w1c_bits = 0
+
+        for field in doc.fields:
+            if not isinstance(field, DocBitfieldField):
+                continue
+
+            bit_from, bit_to = field.bit
+            mask = f'0x{((1 << (bit_to - bit_from)) - 1):02X}'
+            flag = f'0x{(((1 << (bit_to - bit_from)) - 1) << bit_from):02X}'
+            name = self.make_name(field)
+            value = f'(({flags} & ~static_cast<{size_type}>({flag})) | (({argument} & {mask}) << {bit_from}))'
+
+            access = self.make_access(field) if self.opt.bitfield_field_accessor_honor_access else 'rw'
+
+            self.print(f'')
+
+            if access != 'wo':
+                definition = f'constexpr {size_type} {self.opt.bitfield_field_accessor_get_prefix}{name}() const'
+                self.print(f'{definition:<{align}} {{ return static_cast<{size_type}>(({flags} >> {bit_from}) & {mask}); }}')
+
+            if access in [ 'rw', 'wo', 'rwo' ]:
+                definition = f'constexpr void {self.opt.bitfield_field_accessor_set_prefix}{name}(const {size_type} {argument})'
+                self.print(f'{definition:<{align}} {{ {flags} = static_cast<{size_type}>{value}; }}')
+
+                definition = f'[[nodiscard]] constexpr {type_name} {self.opt.bitfield_field_accessor_with_prefix}{name}(const {size_type} {argument}) const'
+                self.print(f'{definition:<{align}} {{ return {type_name}{{ static_cast<{size_type}>{value} }}; }}')
+            elif access == 'w1c':
+                w1c_bits |= int(flag, 16)
+
+                if bit_to - bit_from == 1:
+                    definition = f'[[nodiscard]] static constexpr {type_name} {self.opt.bitfield_field_accessor_ack_prefix}{name}()'
+                    self.print(f'{definition:<{align}} {{ return {type_name}{{ static_cast<{size_type}>({flag}) }}; }}')
+                else:
+                    definition = f'[[nodiscard]] static constexpr {type_name} {self.opt.bitfield_field_accessor_ack_prefix}{name}(const {size_type} {argument} = {mask})'
+                    self.print(f'{definition:<{align}} {{ return {type_name}{{ static_cast<{size_type}>(({argument} & {mask}) << {bit_from}) }}; }}')
+            elif access == 'wc0':
+                definition = f'[[nodiscard]] constexpr {type_name} {self.opt.bitfield_field_accessor_ack_prefix}{name}() const'
+                self.print(f'{definition:<{align}} {{ return {type_name}{{ static_cast<{size_type}>({flags} & ~static_cast<{size_type}>({flag})) }}; }}')
+
+        if w1c_bits:
+            ack = self.opt.bitfield_field_accessor_ack_prefix.rstrip('_')
+
+            self.print(f'')
+            definition = f'[[nodiscard]] static constexpr {type_name} {ack}(const {size_type} {argument})'
+            self.print(f'{definition:<{align}} {{ return {type_name}{{ static_cast<{size_type}>({argument} & 0x{w1c_bits:02X}) }}; }}')
+
+    def print_lookup_table_type(self) -> None:
+        #
+        # Print type of lookup tables (see print_lookup_table()). Hash functions
+        # must match DocPerfectHash.
+        #
+        optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+
+        u8, u16, u32, u64 = self.opt.int_type_8, self.opt.int_type_16, self.opt.int_type_32, self.opt.int_type_64
+
+        self.print(f'/**')
+        self.print(f' * Names and values of an enum or of a group of definitions, with perfect hash')
+        self.print(f' * indices for O(1) lookup in both directions:')
+        self.print(f' *   slot = hash(key, seeds[hash(key, 0) & (S - 1)]) & (S - 1)')
+        self.print(f' *   slots[slot] is index of the entry + 1 (0 if the slot is empty)')
+        self.print(f' */')
+        self.print(f'template <{u32} N, {u32} S>')
+        self.print(f'struct {self.opt.lookup_table_type_name}{optional_curly_brace}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            self.print(f'struct entry{optional_curly_brace}')
+            if self.opt.brace_on_next_line:
+                self.print(f'{{')
+            with self.indent:
+                self.print(f'const char* name;')
+                self.print(f'{u64} value;')
+            self.print(f'}};')
+            self.print(f'')
+            self.print(f'entry entries[N];')
+            self.print(f'{u16} name_seeds[S];')
+            self.print(f'{u16} name_slots[S];')
+            self.print(f'{u16} value_seeds[S];')
+            self.print(f'{u16} value_slots[S];')
+            self.print(f'')
+
+            self.print_block(f'static constexpr {u32} hash(const char* name, const {u32} length, const {u32} seed)', [
+                f'{u32} result = 2166136261u ^ seed;',
+                f'for ({u32} i = 0; i < length; ++i)',
+                f'  result = (result ^ static_cast<{u8}>(name[i])) * 16777619u;',
+                f'return result ^ (result >> 16);',
+            ])
+            self.print(f'')
+            self.print_block(f'static constexpr {u32} hash(const {u64} value, const {u32} seed)', [
+                f'return static_cast<{u32}>(((value ^ seed) * 0x9E3779B97F4A7C15ull) >> 32);',
+            ])
+            self.print(f'')
+            self.print_block(f'constexpr const entry* find_value(const {u64} value) const', [
+                f'const {u16} index = value_slots[hash(value, value_seeds[hash(value, 0) & (S - 1)]) & (S - 1)];',
+                f'return index && entries[index - 1].value == value ? &entries[index - 1] : nullptr;',
+            ])
+            self.print(f'')
+            self.print_block(f'constexpr const entry* find_name(const char* name, const {u32} length) const', [
+                f'const {u16} index = name_slots[hash(name, length, name_seeds[hash(name, length, 0) & (S - 1)]) & (S - 1)];',
+                f'if (!index)',
+                f'  return nullptr;',
+                f'',
+                f'const char* other = entries[index - 1].name;',
+                f'for ({u32} i = 0; i < length; ++i)',
+                f'  if (other[i] != name[i])',
+                f'    return nullptr;',
+                f'',
+                f'return other[length] == \'\\0\' ? &entries[index - 1] : nullptr;',
+            ])
+            self.print(f'')
+            self.print_block(f'constexpr const entry* find_name(const char* name) const', [
+                f'{u32} length = 0;',
+                f'while (name[length])',
+                f'  ++length;',
+                f'',
+                f'return find_name(name, length);',
+            ])
+
+        self.print(f'}};')
+        self.print(f'')
+
+    def print_lookup_table(self, doc: Union[DocGroup, DocEnum]) -> None:
+        #
+        # Print lookup table of definitions (or enum fields) nested directly in the
+        # group (or enum) with integer values, e.g.:
+        #
+        #   inline constexpr lookup_table<2, 2> invept_type_lookup =
+        #   {
+        #     {
+        #       { "invept_single_context", 0x01 },
+        #       { "invept_all_context", 0x02 },
+        #     },
+        #     { ... },                          // name_seeds
+        #     ...
+        #   };
+        #
+        # Names are the names printed for the definitions. If more definitions have
+        # the same value, find_value() returns the first one.
+        #
+        if self._typedef_nesting > 0:
+            self._deferred_definitions.append(lambda: self.print_lookup_table(doc))
+            return
+
+        name_list = []
+        value_list = []
+
+        for field in doc.fields:
+            if not isinstance(field, (DocDefinition, DocEnumField)) or not isinstance(field.value, int):
+                continue
+
+            if isinstance(field, DocEnumField) and not self.opt.enum_as_define:
+                name_list.append(self.make_name(field))
+            else:
+                name_list.append(self.make_name(field, override_name_letter_case=self.opt.definition_name_letter_case))
+
+            value_list.append(field.value)
+
+        if len(name_list) < 2 or not (doc.short_name or doc.long_name):
+            return
+
+        #
+        # Both tables must have the same size (S), values are hashed without
+        # duplicates, so their table might be smaller otherwise.
+        #
+        unique_value_list = list(dict.fromkeys(value_list))
+        name_hash = DocPerfectHash(name_list)
+        value_hash = DocPerfectHash(unique_value_list, name_hash.size)
+
+        size = name_hash.size
+        value_slots = [ value_list.index(unique_value_list[index - 1]) + 1 if index else 0 for index in value_hash.slots ]
+
+        def print_array(array: List[int]) -> None:
+            if len(array) <= 16:
+                self.print(f'{{ {", ".join(map(str, array))} }},')
+                return
+
+            self.print(f'{{')
+            with self.indent:
+                for index in range(0, len(array), 16):
+                    self.print(f'{", ".join(map(str, array[index:index + 16]))},')
+            self.print(f'}},')
+
+        optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+        name = self.make_name(doc, override_name_letter_case='snake_case')
+
+        self.print(f'')
+        self.print(f'inline constexpr {self.opt.lookup_table_type_name}<{len(name_list)}, {size}> '
+                   f'{name}{self.opt.lookup_table_suffix} ={optional_curly_brace}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            self.print(f'{{')
+            with self.indent:
+                for entry_name, entry_value in zip(name_list, value_list):
+                    self.print(f'{{ {self.make_string_literal(entry_name)}, 0x{entry_value:02X} }},')
+            self.print(f'}},')
+
+            print_array(name_hash.seeds)
+            print_array(name_hash.slots)
+            print_array(value_hash.seeds)
+            print_array(value_slots)
+
+        self.print(f'}};')
+
+    def print_bitfield_descriptor_types(self) -> None:
+        #
+        # Print types of descriptor tables (see print_bitfield_descriptor()).
+        #
+        optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+        field_descriptor = self.opt.bitfield_field_descriptor_type_name
+
+        self.print(f'/**')
+        self.print(f' * Descriptor of a bitfield field.')
+        self.print(f' */')
+        self.print(f'struct {field_descriptor}{optional_curly_brace}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            self.print(f'enum class access_type : {self.opt.int_type_8} {{ rw, ro, wo, w1c, wc0, rwo }};')
+            self.print(f'')
+            self.print(f'const char* name;')
+            self.print(f'{self.opt.int_type_8} bit_from;')
+            self.print(f'{self.opt.int_type_8} bit_length;')
+            self.print(f'access_type access;')
+            self.print(f'const char* description;')
+
+        self.print(f'}};')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Descriptor of a bitfield type (name and table of its fields), specialized')
+        self.print(f' * for each bitfield union.')
+        self.print(f' */')
+        self.print(f'template <typename T>')
+        self.print(f'struct {self.opt.bitfield_descriptor_type_name};')
+        self.print(f'')
+
+    def print_bitfield_descriptor(self, doc: DocBitfield) -> None:
+        #
+        # Print specialization of the descriptor type for the bitfield, e.g.:
+        #
+        #   template <>
+        #   struct bitfield_descriptor<cr0>
+        #   {
+        #     static constexpr const char* name = "cr0";
+        #     static constexpr bitfield_field_descriptor fields[] =
+        #     {
+        #       { "protection_enable", 0, 1, bitfield_field_descriptor::access_type::rw, "Protection Enable" },
+        #       ...
+        #     };
+        #   };
+        #
+        # Tables are constexpr (i.e. implicitly inline) static members, so only the
+        # used ones end up in the binary. Reserved bits (gaps between fields and fields
+        # named "Reserved", the same as in print_bitfield_masks()) have no entries.
+        #
+        optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+        field_descriptor = self.opt.bitfield_field_descriptor_type_name
+        type_name = self.make_name(doc)
+
+        self.print(f'')
+        self.print(f'template <>')
+        self.print(f'struct {self.opt.bitfield_descriptor_type_name}<{type_name}>{optional_curly_brace}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            self.print(f'static constexpr const char* name = {self.make_string_literal(type_name)};')
+            self.print(f'static constexpr {field_descriptor} fields[] ={optional_curly_brace}')
+            if self.opt.brace_on_next_line:
+                self.print(f'{{')
+
+            with self.indent:
+                for field in doc.fields:
+                    if not isinstance(field, DocBitfieldField) or re.match(r'^RESERVED\d*$', field.long_name.upper()):
+                        continue
+
+                    bit_from, bit_to = field.bit
+                    name = self.make_string_literal(self.make_name(field))
+                    access = f'{field_descriptor}::access_type::{self.make_access(field)}'
+                    description = self.make_string_literal(field.short_description or '')
+
+                    self.print(f'{{ {name}, {bit_from}, {bit_to - bit_from}, {access}, {description} }},')
+
+            self.print(f'}};')
+
+        self.print(f'}};')
+
+    def is_vmcs_field(self, doc: DocBase) -> bool:
+        #
+        # Definitions with integer values nested in any of vmcs_field_groups (C++ only).
+        #
+        if not self.opt.output_cpp or not self.opt.vmcs_field_traits:
+            return False
+
+        if not isinstance(doc, DocDefinition) or not isinstance(doc.value, int):
+            return False
+
+        parent = doc.parent
+        while parent:
+            if isinstance(parent, DocGroup) and parent.long_name_raw in self.opt.vmcs_field_groups:
+                return True
+
+            parent = parent.parent
+
+        return False
+
+    def make_vmcs_field_value_type(self, doc: DocDefinition) -> Union[str, None]:
+        #
+        # Name of the bitfield union describing value of the VMCS field (first
+        # matching pattern of vmcs_field_value_types), if the union exists (anywhere
+        # in the tree) and its size matches width of the field. Values are converted
+        # from/to the "Flags" member, which is the first member of the union
+        # only with accessors.
+        #
+        if not self.opt.bitfield_field_with_accessors:
+            return None
+
+        width = (doc.value >> 13) & 0x03
+        size = 16 if width == 0 else \
+               32 if width == 2 or (width == 1 and doc.value & 0x01) else \
+               64
+
+        for pattern, bitfield_long_name in self.opt.vmcs_field_value_types.items():
+            if re.search(pattern, doc.long_name):
+                bitfield = self._bitfields.get(bitfield_long_name)
+                return self.make_name(bitfield) if bitfield and bitfield.size == size else None
+
+        return None
+
+    def print_vmcs_field_traits(self) -> None:
+        #
+        # Print traits of VMCS fields (see VMCS_COMPONENT_ENCODING) and typed
+        # VMREAD/VMWRITE, e.g.:
+        #
+        #   vmcs_field<VMCS_GUEST_RIP>::width                   // natural_width
+        #   vmcs_field<VMCS_EXIT_REASON>::read_only              // true
+        #   vmx_vmexit_reason reason = vmread<VMCS_EXIT_REASON>();
+        #   vmwrite<VMCS_GUEST_ES_ACCESS_RIGHTS>(access_rights); // vmx_segment_access_rights
+        #
+        # Width, type and read-only flag are computed from the encoding itself,
+        # so they are valid for any encoding (e.g. high parts of 64-bit fields).
+        # Only value types of fields described by bitfield unions are specialized.
+        #
+        optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+
+        u8, u16, u32, u64 = self.opt.int_type_8, self.opt.int_type_16, self.opt.int_type_32, self.opt.int_type_64
+        field = self.opt.vmcs_field_type_name
+        backend = self.opt.vmcs_field_backend_type_name
+        flags = self.opt.bitfield_field_flags_name
+        align = self.align_indent_adjusted
+
+        self.print(f'/**')
+        self.print(f' * Width of a VMCS field (see VMCS_COMPONENT_ENCODING).')
+        self.print(f' */')
+        self.print(f'enum class {field}_width : {u8} {{ width_16_bit, width_64_bit, width_32_bit, natural_width }};')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Type of a VMCS field (see VMCS_COMPONENT_ENCODING).')
+        self.print(f' */')
+        self.print(f'enum class {field}_type : {u8} {{ control, vmexit_information, guest_state, host_state }};')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Integer type of a VMCS field of the given width. High part of a 64-bit field')
+        self.print(f' * (access type 1) is 32-bit, natural-width fields are 64-bit.')
+        self.print(f' */')
+        self.print(f'template <{field}_width Width, bool High>')
+        self.print(f'struct {field}_raw_type {{ using type = {u64}; }};')
+
+        for width, high, raw_type in [ ('width_16_bit', 'false', u16),
+                                       ('width_32_bit', 'false', u32),
+                                       ('width_64_bit', 'true', u32) ]:
+            self.print(f'')
+            self.print(f'template <>')
+            self.print(f'struct {field}_raw_type<{field}_width::{width}, {high}> {{ using type = {raw_type}; }};')
+
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Type of the value of a VMCS field, specialized for fields described by a bitfield union.')
+        self.print(f' */')
+        self.print(f'template <{u32} Encoding, typename RawType>')
+        self.print(f'struct {field}_value_type {{ using type = RawType; }};')
+
+        for doc in self._vmcs_fields:
+            value_type = self.make_vmcs_field_value_type(doc)
+            if value_type:
+                name = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+
+                self.print(f'')
+                self.print(f'template <typename RawType>')
+                self.print(f'struct {field}_value_type<{name}, RawType> {{ using type = {value_type}; }};')
+
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Raw value of a VMCS field (the "{flags}" member of a bitfield union).')
+        self.print(f' */')
+        definition = f'constexpr {u64} {field}_to_raw(const {u64} value)'
+        self.print(f'{definition:<{align}} {{ return value; }}')
+        self.print(f'')
+        self.print(f'template <typename T>')
+        definition = f'constexpr auto {field}_to_raw(const T& value) -> decltype(value.{flags})'
+        self.print(f'{definition:<{align}} {{ return value.{flags}; }}')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Traits of a VMCS field derived from its encoding.')
+        self.print(f' */')
+        self.print(f'template <{u32} Encoding>')
+        self.print_block(f'struct {field}', [
+            f'static constexpr {u32} encoding = Encoding;',
+            f'static constexpr bool high = (Encoding & 0x01) != 0;',
+            f'static constexpr {field}_width width = static_cast<{field}_width>((Encoding >> 13) & 0x03);',
+            f'static constexpr {field}_type type = static_cast<{field}_type>((Encoding >> 10) & 0x03);',
+            f'static constexpr bool read_only = type == {field}_type::vmexit_information;',
+            f'',
+            f'using raw_type = typename {field}_raw_type<width, high>::type;',
+            f'using value_type = typename {field}_value_type<Encoding, raw_type>::type;',
+            f'',
+            f'{"static constexpr value_type from_raw(const " + u64 + " value)":<{align - self.opt.indent}} '
+            f'{{ return value_type{{ static_cast<raw_type>(value) }}; }}',
+            f'{"static constexpr " + u64 + " to_raw(const value_type value)":<{align - self.opt.indent}} '
+            f'{{ return {field}_to_raw(value); }}',
+        ], end='};')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Backend of vmread()/vmwrite() executing VMREAD/VMWRITE (GCC/Clang, x86-64).')
+        self.print(f' * Any type with the same static read()/write() methods can be used instead,')
+        self.print(f' * e.g. a mock in user-mode tests. Failures (RFLAGS.CF/ZF) are not checked.')
+        self.print(f' */')
+        self.print(f'struct {backend};')
+        self.print(f'')
+        self.print(f'#if defined(__GNUC__) && defined(__x86_64__)')
+        self.print(f'struct {backend}{optional_curly_brace}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+        with self.indent:
+            self.print_block(f'static inline {u64} read(const {u64} encoding)', [
+                f'{u64} value;',
+                f'__asm__ __volatile__("vmread %1, %0" : "=rm"(value) : "r"(encoding) : "cc");',
+                f'return value;',
+            ])
+            self.print(f'')
+            self.print_block(f'static inline void write(const {u64} encoding, const {u64} value)', [
+                f'__asm__ __volatile__("vmwrite %1, %0" : : "r"(encoding), "rm"(value) : "cc");',
+            ])
+        self.print(f'}};')
+        self.print(f'#endif')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * VMREAD/VMWRITE with the type of the field, e.g.:')
+        self.print(f' *   rflags flags = vmread<VMCS_GUEST_RFLAGS>();')
+        self.print(f' *   vmwrite<VMCS_GUEST_RFLAGS>(flags.with_interrupt_enable_flag(1));')
+        self.print(f' * Writes of read-only (VM-exit information) fields do not compile.')
+        self.print(f' */')
+        self.print(f'template <{u32} Encoding, typename Backend = {backend}>')
+        self.print_block(f'inline typename {field}<Encoding>::value_type vmread()', [
+            f'return {field}<Encoding>::from_raw(Backend::read(Encoding));',
+        ])
+        self.print(f'')
+        self.print(f'template <{u32} Encoding, typename Backend = {backend}>')
+        self.print_block(f'inline void vmwrite(const typename {field}<Encoding>::value_type value)', [
+            f'static_assert(!{field}<Encoding>::read_only, "VMCS field is read-only");',
+            f'Backend::write(Encoding, {field}<Encoding>::to_raw(value));',
+        ])
+
+    def make_vmcs_field_list(self) -> List[Tuple[int, str]]:
+        #
+        # Encodings and names of VMCS fields in ascending order of encodings
+        # (fields with the same encoding are listed once).
+        #
+        result = {}
+
+        for doc in self._vmcs_fields:
+            name = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+            result.setdefault(doc.value, name)
+
+        return sorted(result.items())
+
+    def print_vmcs_field_index(self) -> None:
+        #
+        # Print dense indices of VMCS fields, i.e. index -> encoding table and
+        # constexpr encoding -> index function:
+        #
+        #   vmcs_field_encodings[vmcs_field_index(VMCS_GUEST_RIP)] == VMCS_GUEST_RIP
+        #
+        # Encodings are sparse, but the index (bits 1-9), type (bits 10-11) and
+        # width (bits 13-14) of defined fields fit into a few bits (the index of
+        # any field is < 32), so their concatenation is used as a slot of a small
+        # table of dense indices. Empty slots (and encodings with other bits set)
+        # are rejected by comparison with the encoding of the found index:
+        #
+        #   index = indices[((encoding >> 1) & 0x1F) | ((encoding >> 5) & 0x60) | ((encoding >> 6) & 0x180)]
+        #   return encodings[index] == encoding ? index : count
+        #
+        u8, u16, u32 = self.opt.int_type_8, self.opt.int_type_16, self.opt.int_type_32
+        field = self.opt.vmcs_field_type_name
+        field_list = self.make_vmcs_field_list()
+
+        index_bits = max(max(((encoding >> 1) & 0x1FF) for encoding, _ in field_list).bit_length(), 1)
+        index_mask = (1 << index_bits) - 1
+        type_shift, type_mask = 10 - index_bits, 0x03 << index_bits
+        width_shift, width_mask = 13 - index_bits - 2, 0x03 << (index_bits + 2)
+
+        def make_slot(encoding: int) -> int:
+            return ((encoding >> 1) & index_mask) | \
+                   ((encoding >> type_shift) & type_mask) | \
+                   ((encoding >> width_shift) & width_mask)
+
+        indices = [ 0 ] * (16 << index_bits)
+        for index, (encoding, name) in enumerate(field_list):
+            slot = make_slot(encoding)
+            if indices[slot] or slot == make_slot(field_list[0][0]) and index:
+                raise Exception(f'VMCS field {name} has the same index, type and width as another field')
+
+            indices[slot] = index
+
+        index_type = u8 if len(field_list) <= 0xFF else u16
+
+        self.print(f'/**')
+        self.print(f' * Encodings of VMCS fields in ascending order, i.e. dense index of a field -> encoding.')
+        self.print(f' */')
+        self.print_block(f'inline constexpr {u32} {field}_encodings[] =', [
+            f'{name},' for _, name in field_list
+        ], end='};')
+        self.print(f'')
+        self.print(f'inline constexpr {u32} {field}_count = {len(field_list)};')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Dense indices of VMCS fields by index, type and width of their encoding (see {field}_index()).')
+        self.print(f' */')
+        self.print_block(f'inline constexpr {index_type} {field}_indices[{len(indices)}] =', [
+            ', '.join(map(str, indices[offset:offset + 32])) + ','
+            for offset in range(0, len(indices), 32)
+        ], end='};')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Dense index of a VMCS field in O(1) without branches ({field}_count if the encoding')
+        self.print(f' * is not in {field}_encodings).')
+        self.print(f' */')
+        self.print_block(f'constexpr {u32} {field}_index(const {u32} encoding)', [
+            f'const {u32} index = {field}_indices[((encoding >> 1) & 0x{index_mask:02X}) | '
+            f'((encoding >> {type_shift}) & 0x{type_mask:02X}) | ((encoding >> {width_shift}) & 0x{width_mask:02X})];',
+            f'return {field}_encodings[index] == encoding ? index : {field}_count;',
+        ])
+
+    def print_vmcs_field_cache(self) -> None:
+        #
+        # Print software cache of VMCS fields with one slot per field (see
+        # print_vmcs_field_index()) and valid/dirty bitmaps, e.g.:
+        #
+        #   vmcs_cache<> cache{};
+        #   cache.write<VMCS_GUEST_RIP>(cache.read<VMCS_GUEST_RIP>() + length);
+        #   cache.flush();
+        #
+        # Index of the field is a constant, so read()/write() compile into a bit
+        # test and a load/store (and a VMREAD on the first read).
+        #
+        u32, u64 = self.opt.int_type_32, self.opt.int_type_64
+        field = self.opt.vmcs_field_type_name
+        cache = self.opt.vmcs_field_cache_type_name
+        backend = self.opt.vmcs_field_backend_type_name
+        words = f'({field}_count + 63) / 64'
+
+        def make_index_lines() -> List[str]:
+            return [
+                f'constexpr {u32} index = {field}_index(Encoding);',
+                f'constexpr {u64} bit = 1ull << (index % 64);',
+                f'static_assert(index < {field}_count, "VMCS field is not cached (or is HIGH encoding of a 64-bit field)");',
+            ]
+
+        self.print(f'/**')
+        self.print(f' * Index of the lowest set bit (bits must not be 0).')
+        self.print(f' */')
+        self.print(f'#if defined(__GNUC__)')
+        self.print_block(f'inline {u32} {cache}_lowest_bit(const {u64} bits)', [
+            f'return static_cast<{u32}>(__builtin_ctzll(bits));',
+        ])
+        self.print(f'#else')
+        self.print_block(f'inline {u32} {cache}_lowest_bit(const {u64} bits)', [
+            f'{u32} result = 0;',
+            f'while (!((bits >> result) & 1))',
+            f'  ++result;',
+            f'',
+            f'return result;',
+        ])
+        self.print(f'#endif')
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * 1 if the encoding is HIGH encoding of a 64-bit field (width 1, access type 1), 0 otherwise.')
+        self.print(f' */')
+        self.print_block(f'constexpr {u32} {cache}_high_bit(const {u32} encoding)', [
+            f'return ((encoding >> 13) & 3) == 1 ? encoding & 1 : 0;',
+        ])
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Software cache of VMCS fields (one slot per field, zero-initialized, e.g. {cache}<> cache{{}}).')
+        self.print(f' * Fields are read by VMREAD on the first read() and written by VMWRITE on flush(),')
+        self.print(f' * which writes only the dirty fields, in order of their encodings.')
+        self.print(f' * Call invalidate() on VM exit and flush() before VM entry.')
+        self.print(f' */')
+        self.print(f'template <typename Backend = {backend}>')
+        self.print(f'struct {cache}{" {" if not self.opt.brace_on_next_line else ""}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            self.print(f'{u64} values[{field}_count];')
+            self.print(f'{u64} valid[{words}];')
+            self.print(f'{u64} dirty[{words}];')
+            self.print(f'')
+            self.print(f'template <{u32} Encoding>')
+            self.print_block(f'typename {field}<Encoding>::value_type read()', [
+                *make_index_lines(),
+                f'',
+                f'if (!(valid[index / 64] & bit))',
+                f'{{',
+                f'  values[index] = Backend::read(Encoding);',
+                f'  valid[index / 64] |= bit;',
+                f'}}',
+                f'',
+                f'return {field}<Encoding>::from_raw(values[index]);',
+            ])
+            self.print(f'')
+            self.print(f'template <{u32} Encoding>')
+            self.print_block(f'void write(const typename {field}<Encoding>::value_type value)', [
+                *make_index_lines(),
+                f'static_assert(!{field}<Encoding>::read_only, "VMCS field is read-only");',
+                f'',
+                f'values[index] = {field}<Encoding>::to_raw(value);',
+                f'valid[index / 64] |= bit;',
+                f'dirty[index / 64] |= bit;',
+            ])
+            self.print(f'')
+            self.print(f'/**')
+            self.print(f' * Read/write of a field given at run time (e.g. emulated VMREAD/VMWRITE of a nested')
+            self.print(f' * hypervisor). Fields which are not cached are read/written directly. HIGH encoding')
+            self.print(f' * of a 64-bit field (access type 1) reads/writes upper 32 bits of the FULL slot.')
+            self.print(f' */')
+            self.print_block(f'{u64} read(const {u32} encoding)', [
+                f'const {u32} high = {cache}_high_bit(encoding);',
+                f'const {u32} index = {field}_index(encoding & ~high);',
+                f'if (index == {field}_count)',
+                f'  return Backend::read(encoding);',
+                f'',
+                f'const {u64} bit = 1ull << (index % 64);',
+                f'if (!(valid[index / 64] & bit))',
+                f'{{',
+                f'  values[index] = Backend::read(encoding & ~high);',
+                f'  valid[index / 64] |= bit;',
+                f'}}',
+                f'',
+                f'return high ? values[index] >> 32 : values[index];',
+            ])
+            self.print(f'')
+            self.print_block(f'void write(const {u32} encoding, const {u64} value)', [
+                f'const {u32} high = {cache}_high_bit(encoding);',
+                f'const {u32} index = {field}_index(encoding & ~high);',
+                f'if (index == {field}_count)',
+                f'{{',
+                f'  Backend::write(encoding, value);',
+                f'  return;',
+                f'}}',
+                f'',
+                f'const {u64} bit = 1ull << (index % 64);',
+                f'if (!high)',
+                f'  values[index] = value;',
+                f'else',
+                f'{{',
+                f'  if (!(valid[index / 64] & bit))',
+                f'    values[index] = Backend::read(encoding & ~high);',
+                f'',
+                f'  values[index] = (values[index] & 0xFFFFFFFF) | (value << 32);',
+                f'}}',
+                f'',
+                f'valid[index / 64] |= bit;',
+                f'dirty[index / 64] |= bit;',
+            ])
+            self.print(f'')
+            self.print_block(f'void flush()', [
+                f'for ({u32} word = 0; word < {words}; ++word)',
+                f'{{',
+                f'  for ({u64} bits = dirty[word]; bits; bits &= bits - 1)',
+                f'  {{',
+                f'    const {u32} index = word * 64 + {cache}_lowest_bit(bits);',
+                f'    Backend::write({field}_encodings[index], values[index]);',
+                f'  }}',
+                f'',
+                f'  dirty[word] = 0;',
+                f'}}',
+            ])
+            self.print(f'')
+            self.print(f'/**')
+            self.print(f' * Forget values read from the VMCS (pending writes are kept).')
+            self.print(f' */')
+            self.print_block(f'void invalidate()', [
+                f'for ({u32} word = 0; word < {words}; ++word)',
+                f'  valid[word] = dirty[word];',
+            ])
+
+        self.print(f'}};')
+
+    def print_vmcs_shadow_bitmaps(self) -> None:
+        #
+        # Print VMREAD/VMWRITE bitmaps of VMCS shadowing with constexpr builder
+        # and the default set of shadowed fields (vmcs_shadow_read_fields and
+        # vmcs_shadow_write_fields), e.g.:
+        #
+        #   inline constexpr vmcs_shadow_bitmaps vmcs_shadow_bitmaps_default =
+        #     vmcs_shadow_bitmaps::intercept_all()
+        #       .shadow_read(VMCS_EXIT_REASON)
+        #       ...
+        #       .shadow(VMCS_GUEST_RIP);
+        #
+        u32, u64 = self.opt.int_type_32, self.opt.int_type_64
+        field = self.opt.vmcs_field_type_name
+        bitmaps = self.opt.vmcs_shadow_bitmaps_type_name
+
+        names = { doc.long_name: self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+                  for doc in self._vmcs_fields }
+
+        def make_field_list(name_list: List[str]) -> List[str]:
+            for name in name_list:
+                if name not in names:
+                    raise Exception(f'Unknown VMCS field in shadow fields: {name}')
+
+            return [ names[name] for name in name_list ]
+
+        read_list = make_field_list(self.opt.vmcs_shadow_read_fields)
+        write_list = make_field_list(self.opt.vmcs_shadow_write_fields)
+
+        def make_bit_lines(bitmap_list: List[str], operation: str) -> List[str]:
+            statement_list = [ f'  {bitmap}[encoding / 64] {operation};' for bitmap in bitmap_list ]
+
+            return [
+                f'if (encoding < 0x8000)',
+                *(statement_list if len(statement_list) == 1 else [ f'{{', *statement_list, f'}}' ]),
+                f'',
+                f'return *this;',
+            ]
+
+        self.print(f'/**')
+        self.print(f' * VMREAD and VMWRITE bitmaps of VMCS shadowing (4 KiB each). Bit of a field (bits 0-14')
+        self.print(f' * of the encoding) set means that VMREAD/VMWRITE of the field in VMX non-root operation')
+        self.print(f' * causes VM exit, clear means that it accesses the shadow VMCS. Encodings with any of')
+        self.print(f' * bits 15-31 set always cause VM exit. High parts of 64-bit fields (access type 1)')
+        self.print(f' * have their own bits.')
+        self.print(f' */')
+        self.print(f'struct alignas(4096) {bitmaps}{" {" if not self.opt.brace_on_next_line else ""}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            self.print(f'{u64} vmread_bitmap[512];')
+            self.print(f'{u64} vmwrite_bitmap[512];')
+            self.print(f'')
+            self.print_block(f'static constexpr {bitmaps} intercept_all()', [
+                f'{bitmaps} result{{}};',
+                f'for ({u32} index = 0; index < 512; ++index)',
+                f'{{',
+                f'  result.vmread_bitmap[index] = ~0ull;',
+                f'  result.vmwrite_bitmap[index] = ~0ull;',
+                f'}}',
+                f'',
+                f'return result;',
+            ])
+
+            for verb, operation in [ ('shadow', '&= ~(1ull << (encoding % 64))'), ('intercept', '|= 1ull << (encoding % 64)') ]:
+                for suffix, bitmap_list in [ ('_read', [ 'vmread_bitmap' ]),
+                                             ('_write', [ 'vmwrite_bitmap' ]),
+                                             ('', [ 'vmread_bitmap', 'vmwrite_bitmap' ]) ]:
+                    self.print(f'')
+                    self.print_block(f'constexpr {bitmaps}& {verb}{suffix}(const {u32} encoding)',
+                                     make_bit_lines(bitmap_list, operation))
+
+            self.print(f'')
+            self.print(f'/**')
+            self.print(f' * All fields of {field}_encodings of the given width and type (e.g. guest-state')
+            self.print(f' * natural-width fields), i.e. all fields of one group of VMCS fields.')
+            self.print(f' */')
+            self.print(f'template <typename Function>')
+            self.print_block(f'constexpr {bitmaps}& for_each(const {field}_width width, const {field}_type type, Function function)', [
+                f'for ({u32} index = 0; index < {field}_count; ++index)',
+                f'{{',
+                f'  const {u32} encoding = {field}_encodings[index];',
+                f'',
+                f'  if (static_cast<{field}_width>((encoding >> 13) & 0x03) == width &&',
+                f'      static_cast<{field}_type>((encoding >> 10) & 0x03) == type)',
+                f'    function(*this, encoding);',
+                f'}}',
+                f'',
+                f'return *this;',
+            ])
+
+            for verb in [ 'shadow', 'intercept' ]:
+                for suffix in [ '_read', '_write', '' ]:
+                    self.print(f'')
+                    self.print_block(f'constexpr {bitmaps}& {verb}{suffix}(const {field}_width width, const {field}_type type)', [
+                        f'return for_each(width, type, []({bitmaps}& self, const {u32} encoding) {{ self.{verb}{suffix}(encoding); }});',
+                    ])
+
+        self.print(f'}};')
+
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Recommended shadow bitmaps: VM-exit information fields read by the exit handlers')
+        self.print(f' * of a nested hypervisor are VMREAD without VM exit, guest state and controls it')
+        self.print(f' * updates on most exits (RIP, RSP, RFLAGS, interruptibility, event injection, ...)')
+        self.print(f' * are also VMWRITE without VM exit.')
+        self.print(f' */')
+        self.print(f'inline constexpr {bitmaps} {bitmaps}_default =')
+        with self.indent:
+            self.print(f'{bitmaps}::intercept_all()')
+            with self.indent:
+                lines = [ f'.shadow_read({name})' for name in read_list ] + \
+                        [ f'.shadow({name})' for name in write_list ]
+
+                for index, line in enumerate(lines):
+                    self.print(f'{line};' if index == len(lines) - 1 else line)
+
+        if not lines:
+            self.print(f';')
+
+    def is_msr(self, doc: DocBase) -> bool:
+        #
+        # Definitions with integer values nested (through groups only) in any of
+        # msr_bitmap_groups (C++ only). Custom definitions (bases and sizes of fixed
+        # range MTRRs, counts, ...) aren't MSR addresses.
+        #
+        if not self.opt.output_cpp or not self.opt.msr_bitmap_builder:
+            return False
+
+        if not isinstance(doc, DocDefinition) or not isinstance(doc.value, int) or doc.tag == 'Custom':
+            return False
+
+        parent = doc.parent
+        while isinstance(parent, DocGroup):
+            if parent.long_name_raw in self.opt.msr_bitmap_groups:
+                return True
+
+            parent = parent.parent
+
+        return False
+
+    def print_msr_bitmap(self) -> None:
+        #
+        # Print MSR bitmap with the same layout as msr_bitmap_struct, constexpr
+        # builder, inclusive ranges of MSRs of each group nested in msr_bitmap_groups
+        # and the default bitmap (msr_bitmap_pass_through_read_msrs and
+        # msr_bitmap_pass_through_write_msrs), e.g.:
+        #
+        #   inline constexpr msr_bitmap_range ia32_x2apic_isr_msrs[] = { { IA32_X2APIC_ISR0, IA32_X2APIC_ISR7 } };
+        #
+        #   inline constexpr msr_bitmap msr_bitmap_default =
+        #     msr_bitmap::intercept_all()
+        #       .pass_through_read(IA32_MPERF)
+        #       ...
+        #       .pass_through(IA32_FS_BASE);
+        #
+        u32, u64 = self.opt.int_type_32, self.opt.int_type_64
+        bitmap = self.opt.msr_bitmap_type_name
+        definition_name_letter_case = self.opt.definition_name_letter_case
+
+        definitions = { field.long_name_standalone: self.make_name(field, override_name_letter_case=definition_name_letter_case)
+                        for field in self._msr_bitmap.fields if isinstance(field, DocDefinition) }
+        members = { field.long_name_standalone: field
+                    for field in self._msr_bitmap.fields if isinstance(field, DocStructField) }
+
+        for name in [ 'MSR_ID_LOW_MIN', 'MSR_ID_LOW_MAX', 'MSR_ID_HIGH_MIN', 'MSR_ID_HIGH_MAX' ]:
+            if name not in definitions:
+                raise Exception(f'Missing definition in {self.opt.msr_bitmap_struct}: {name}')
+
+        for name in [ 'RDMSR_LOW', 'RDMSR_HIGH', 'WRMSR_LOW', 'WRMSR_HIGH' ]:
+            if name not in members or members[name].size % 64:
+                raise Exception(f'Missing field in {self.opt.msr_bitmap_struct}: {name}')
+
+        #
+        # Bitmaps of MSRs are indexed by 64-bit words (in the order of the struct fields).
+        #
+        member_list = [ (self.make_name(field), field.size // 64) for field in members.values() ]
+        member_names = { name: self.make_name(field) for name, field in members.items() }
+        word_count = members['RDMSR_LOW'].size // 64
+
+        #
+        # Inclusive ranges of consecutive addresses of MSRs nested directly in each group.
+        #
+        msr_names = {}
+        group_ranges = {}
+
+        for doc in self._msrs:
+            name = self.make_name(doc, override_name_letter_case=definition_name_letter_case)
+            msr_names.setdefault(doc.long_name, name)
+
+            if doc.parent.long_name_raw not in self.opt.msr_bitmap_groups and doc.parent.long_name:
+                group_ranges.setdefault(doc.parent, {}).setdefault(doc.value, name)
+
+        group_names = {}
+
+        for group, addresses in group_ranges.items():
+            range_list = []
+
+            for address, name in sorted(addresses.items()):
+                if range_list and range_list[-1][0] + 1 == address:
+                    range_list[-1] = (address, range_list[-1][1], name)
+                else:
+                    range_list.append((address, name, name))
+
+            group_ranges[group] = [ (first, last) for _, first, last in range_list ]
+            group_names.setdefault(group.long_name,
+                                   f'{self.make_name(group, override_name_letter_case="snake_case")}{self.opt.msr_bitmap_group_suffix}')
+
+        def make_msr_list(name_list: List[str]) -> List[str]:
+            for name in name_list:
+                if name not in msr_names and name not in group_names:
+                    raise Exception(f'Unknown MSR in pass-through MSRs: {name}')
+
+            return [ msr_names.get(name) or group_names[name] for name in name_list ]
+
+        read_list = make_msr_list(self.opt.msr_bitmap_pass_through_read_msrs)
+        write_list = make_msr_list(self.opt.msr_bitmap_pass_through_write_msrs)
+
+        self.print(f'/**')
+        self.print(f' * Inclusive range of MSR addresses, e.g. all x2APIC MSRs or all MSRs of one group.')
+        self.print(f' */')
+        self.print_block(f'struct {bitmap}_range', [
+            f'{u32} first;',
+            f'{u32} last;',
+        ], end='};')
+
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * MSR bitmap with the same layout as {self.make_name(self._msr_bitmap)} (4 KiB). Bit of an MSR set')
+        self.print(f' * means that RDMSR/WRMSR of the MSR in VMX non-root operation causes VM exit, clear means')
+        self.print(f' * that it is passed through. MSRs outside of the low and high ranges always cause VM exit,')
+        self.print(f' * so they are ignored. Ranges are filled by whole 64-bit words, i.e. the bitmap is built')
+        self.print(f' * at compile time and copied as a whole to the bitmap of each VM.')
+        self.print(f' */')
+        self.print(f'struct alignas(4096) {bitmap}{" {" if not self.opt.brace_on_next_line else ""}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            for name, count in member_list:
+                self.print(f'{u64} {name}[{count}];')
+
+            self.print(f'')
+            self.print_block(f'static constexpr {bitmap} intercept_all()', [
+                f'{bitmap} result{{}};',
+                f'for ({u32} index = 0; index < {word_count}; ++index)',
+                f'{{',
+                *[ f'  result.{name}[index] = ~0ull;' for name, _ in member_list ],
+                f'}}',
+                f'',
+                f'return result;',
+            ])
+
+            self.print(f'')
+            self.print_block(f'static constexpr {bitmap} pass_through_all()', [
+                f'return {bitmap}{{}};',
+            ])
+
+            for verb, intercept in [ ('intercept', 'true'), ('pass_through', 'false') ]:
+                for suffix, bitmap_list in [ ('_read', [ ('RDMSR_LOW', 'RDMSR_HIGH') ]),
+                                             ('_write', [ ('WRMSR_LOW', 'WRMSR_HIGH') ]),
+                                             ('', [ ('RDMSR_LOW', 'RDMSR_HIGH'), ('WRMSR_LOW', 'WRMSR_HIGH') ]) ]:
+                    self.print(f'')
+                    self.print_block(f'constexpr {bitmap}& {verb}{suffix}(const {u32} first, const {u32} last)', [
+                        *[ f'fill({member_names[low]}, {member_names[high]}, first, last, {intercept});' for low, high in bitmap_list ],
+                        f'return *this;',
+                    ])
+
+                    self.print(f'')
+                    self.print_block(f'constexpr {bitmap}& {verb}{suffix}(const {u32} msr)', [
+                        f'return {verb}{suffix}(msr, msr);',
+                    ])
+
+                    self.print(f'')
+                    self.print(f'template <{u32} Count>')
+                    self.print_block(f'constexpr {bitmap}& {verb}{suffix}(const {bitmap}_range (&ranges)[Count])', [
+                        f'for (const {bitmap}_range& range : ranges)',
+                        f'  {verb}{suffix}(range.first, range.last);',
+                        f'',
+                        f'return *this;',
+                    ])
+
+            self.print(f'')
+            self.print_block(f'static constexpr void fill({u64} (&low)[{word_count}], {u64} (&high)[{word_count}], '
+                             f'const {u32} first, const {u32} last, const bool intercept)', [
+                f'fill(low, first, last, {definitions["MSR_ID_LOW_MIN"]}, {definitions["MSR_ID_LOW_MAX"]}, intercept);',
+                f'fill(high, first, last, {definitions["MSR_ID_HIGH_MIN"]}, {definitions["MSR_ID_HIGH_MAX"]}, intercept);',
+            ])
+
+            self.print(f'')
+            self.print(f'/**')
+            self.print(f' * Set (or clear) bits of MSRs first-last (clipped to min-max) of one bitmap, only the first')
+            self.print(f' * and the last word are masked.')
+            self.print(f' */')
+            self.print_block(f'static constexpr void fill({u64} (&words)[{word_count}], {u32} first, {u32} last, '
+                             f'const {u32} min, const {u32} max, const bool intercept)', [
+                f'first = first < min ? min : first;',
+                f'last = last > max ? max : last;',
+                f'',
+                f'if (first > last)',
+                f'  return;',
+                f'',
+                f'const {u32} first_word = (first - min) / 64;',
+                f'const {u32} last_word = (last - min) / 64;',
+                f'const {u64} first_mask = ~0ull << ((first - min) % 64);',
+                f'const {u64} last_mask = ~0ull >> (63 - (last - min) % 64);',
+                f'',
+                f'for ({u32} index = first_word; index <= last_word; ++index)',
+                f'{{',
+                f'  const {u64} mask = (index == first_word ? first_mask : ~0ull) & (index == last_word ? last_mask : ~0ull);',
+                f'  words[index] = intercept ? words[index] | mask : words[index] & ~mask;',
+                f'}}',
+            ])
+
+        self.print(f'}};')
+
+        self.print(f'')
+        self.print(f'static_assert(sizeof({bitmap}) == sizeof({self.make_name(self._msr_bitmap)}), "Invalid size of {bitmap}");')
+
+        for group, range_list in group_ranges.items():
+            ranges = [ f'{{ {first}, {last} }}' for first, last in range_list ]
+
+            self.print(f'')
+            if len(ranges) == 1:
+                self.print(f'inline constexpr {bitmap}_range {group_names[group.long_name]}[] = {{ {ranges[0]} }};')
+            else:
+                self.print_block(f'inline constexpr {bitmap}_range {group_names[group.long_name]}[] =',
+                                 [ f'{line},' for line in ranges ], end='};')
+
+        self.print(f'')
+        self.print(f'/**')
+        self.print(f' * Recommended MSR bitmap: RDMSR of MSRs which are safe to read by the guest (MTRRs, ...)')
+        self.print(f' * and both RDMSR and WRMSR of MSRs which aren\'t used by the host in VMX root operation')
+        self.print(f' * (FS/GS base, ...) are passed through, everything else causes VM exit.')
+        self.print(f' */')
+        self.print(f'inline constexpr {bitmap} {bitmap}_default =')
+        with self.indent:
+            self.print(f'{bitmap}::intercept_all()')
+            with self.indent:
+                lines = [ f'.pass_through_read({name})' for name in read_list ] + \
+                        [ f'.pass_through({name})' for name in write_list ]
+
+                for index, line in enumerate(lines):
+                    self.print(f'{line};' if index == len(lines) - 1 else line)
+
+        if not lines:
+            self.print(f';')
+
+    def print_block(self, header: str, body: List[str], end: str='}') -> None:
+        #
+        # Print block of code (function, struct, ...) with already formatted
+        # body lines, e.g. print_block('struct x', [ 'int y;' ], end='};').
+        #
+        optional_curly_brace = ' {' if not self.opt.brace_on_next_line else ''
+
+        self.print(f'{header}{optional_curly_brace}')
+        if self.opt.brace_on_next_line:
+            self.print(f'{{')
+
+        with self.indent:
+            for line in body:
+                self.print(line)
+
+        self.print(end)
+
+    def make_string_literal(self, text: str) -> str:
+        #
+        # Descriptions have '#' escaped for Doxygen.
+        #
+        text = self._fix_text(text).replace('\\#', '#')
+        text = text.replace('\\', '\\\\').replace('"', '\\"').replace('\n', ' ')
+        return f'"{text}"'
+
+    def make_access(self, doc: DocBase) -> str:
+        #
+        # Classify access of the document (or of its nearest parent with access,
+        # e.g. MSR definition containing the bitfield) into:
+        #   ro, wo, w1c (write 1 to clear), wc0 (write 0 to clear), rwo (write once) or rw.
+        #
+        # Counters tagged "R/Write to clear" (e.g. IA32_MPERF) are cleared by writing 0.
+        # Fields of bitfield_w1c_registers are W1C regardless of their access, because
+        # the manual lists some of them (e.g. IA32_PERF_GLOBAL_STATUS_RESET) as R/W.
+        #
+        parent = doc
+        while parent:
+            if parent.long_name in self.opt.bitfield_w1c_registers:
+                return 'w1c'
+
+            parent = parent.parent
+
+        while doc and not doc.access:
+            doc = doc.parent
+
+        if not doc:
+            return 'rw'
+
+        access = doc.access.upper().replace(' ', '')
+
+        if access in [ 'RO', 'R/O', 'R', 'R/0', 'READONLY' ] or access.startswith('RO,'):
+            return 'ro'
+        elif access in [ 'WO', 'W/O', 'W', 'WRITEONLY' ]:
+            return 'wo'
+        elif access in [ 'W1C', 'R/W1C', 'RW1C' ]:
+            return 'w1c'
+        elif access in [ 'R/WC0', 'RWC0', 'R/W0', 'R/WRITETOCLEAR' ]:
+            return 'wc0'
+        elif access in [ 'R/WO', 'R/W1-ONCE' ]:
+            return 'rwo'
+        else:
+            return 'rw'
+
+    def make_name(self, doc: DocBase,
+                  long: bool=None, raw: bool=False, standalone: bool=False,
+                  override_name_letter_case: str=None) -> str:
+        assert not (raw and standalone)  # invalid combination
+
+        if long is None:
+            long = getattr(self.opt, f'{doc.type}_prefer_long_names')
+
+        if getattr(self.opt, f'{doc.type}_prefer_alternative_names') and doc.alternative_name:
+            result = doc.alternative_name
+        else:
+            if raw:
+                result = doc.long_name_raw if long else doc.short_name_raw
+            elif standalone:
+                result = doc.long_name_standalone if long else doc.short_name_standalone
+            else:
+                result = doc.long_name if long else doc.short_name
+
+        if override_name_letter_case is not None:
+            letter_case = override_name_letter_case
+        else:
+            letter_case = getattr(self.opt, f'{doc.type}_name_letter_case')
+
+        return DocText.convert_case(result, letter_case)
+
+    def make_bitfield_definition_name(self, doc: DocBitfield) -> str:
+        result = self.make_name(doc, override_name_letter_case=self.opt.definition_name_letter_case)
+
+        #
+        # !!! INCREDIBLY UGLY HACK !!!
+        # Remove _REGISTER suffix.
+        #
+        if 'name_with_suffix' in doc._doc:
+            result = result[0:(len(result) - len(doc._doc['name_with_suffix']) - 1)]
+
+        return result
 
     def make_size_type(self, size) -> Union[str, Tuple[str, str]]:
         try:
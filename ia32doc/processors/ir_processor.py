@@ -0,0 +1,210 @@
+from typing import Dict, List, Set
+
+import json
+import struct
+import time
+
+from .base import DocProcessor
+
+from .. import __version__
+from ..doc import DocBase, DOC_TYPES
+from ..ir import DocIr
+from ..profile import DocProfile
+
+#
+# Binary format (all values are little-endian).
+# =============================================
+#
+# Header:
+#   char     magic[8]                   "IA32DOC\0"
+#   uint32_t version                    DOC_IR_BINARY_VERSION
+#   uint32_t header_size
+#   uint32_t record_count
+#   uint32_t record_size
+#   uint32_t records_offset             Offset of the records array.
+#   uint32_t field_indices_offset       Offset of the uint32_t array of children indices.
+#   uint32_t field_indices_count
+#   uint32_t strings_offset             Offset of the string table.
+#   uint32_t strings_size
+#   uint32_t root_count                 Root records are stored at indices 0..root_count-1
+#                                       of the field_indices array.
+#
+# Record (naturally aligned, i.e. it can be described by a plain C struct):
+#   uint64_t value                      Valid if DOC_IR_BINARY_FLAG_VALUE. Offset into the
+#                                       string table if DOC_IR_BINARY_FLAG_VALUE_STRING.
+#   int32_t  parent_index               -1 for root records.
+#   uint32_t field_indices_first        Children are field_indices[first..first+count-1].
+#   uint32_t field_indices_count
+#   uint8_t  type                       Index into DOC_TYPES.
+#   uint8_t  flags                      DOC_IR_BINARY_FLAG_*
+#   uint8_t  bit_from                   Valid if DOC_IR_BINARY_FLAG_BIT.
+#   uint8_t  bit_to                     (exclusive)
+#   int32_t  size                       Valid if DOC_IR_BINARY_FLAG_SIZE.
+#   uint32_t strings[N]                 Offsets into the string table, in order of
+#                                       DOC_IR_BINARY_STRINGS.
+#   uint8_t  padding[4]
+#
+# String table contains NUL-terminated UTF-8 strings. Offset 0 is always
+# an empty string. List values (see, reference) are joined with '\n'.
+#
+DOC_IR_BINARY_MAGIC = b'IA32DOC\0'
+DOC_IR_BINARY_VERSION = 1
+
+DOC_IR_BINARY_FLAG_VALUE            = 0x01
+DOC_IR_BINARY_FLAG_VALUE_STRING     = 0x02
+DOC_IR_BINARY_FLAG_SIZE             = 0x04
+DOC_IR_BINARY_FLAG_BIT              = 0x08
+DOC_IR_BINARY_FLAG_SEE_LIST         = 0x10
+DOC_IR_BINARY_FLAG_REFERENCE_LIST   = 0x20
+
+DOC_IR_BINARY_STRINGS = [
+    'path',
+    'alternative_type',
+    'short_name',
+    'long_name',
+    'alternative_name',
+    'short_name_standalone',
+    'long_name_standalone',
+    'short_description',
+    'long_description',
+    'children_name_with_prefix',
+    'children_name_with_suffix',
+    'note',
+    'access',
+    'todo',
+    'tag',
+    'remarks',
+    'see',
+    'reference',
+]
+
+DOC_IR_BINARY_HEADER = struct.Struct('<8s10I')
+DOC_IR_BINARY_RECORD = struct.Struct(f'<QiIIBBBBi{len(DOC_IR_BINARY_STRINGS)}I4x')
+
+
+class DocIrProcessor(DocProcessor):
+    '''
+    Writes the resolved representation of documents (see DocIr) in the
+    compact binary format (ir_format: binary) or as JSON (ir_format: json).
+    '''
+
+    def run(self, doc_list: List[DocBase], changed_doc_set: Set[DocBase]=None) -> None:
+        self.ir = DocIr.resolve(doc_list)
+
+        start = time.perf_counter()
+
+        with DocProfile.measure('emit', self.opt.output_filename):
+            if self.opt.ir_format == 'binary':
+                content = self.make_binary(self.ir)
+            elif self.opt.ir_format == 'json':
+                content = json.dumps(self.make_json(self.ir), indent=1, ensure_ascii=False) + '\n'
+            else:
+                raise Exception(f'Invalid IR format: {self.opt.ir_format}')
+
+            content = self.write_if_changed(self.opt.output_filename, content, encoding='utf-8')
+
+        DocProfile.add_output(self.opt.output_filename, content, time.perf_counter() - start)
+
+    @staticmethod
+    def make_json(ir: DocIr) -> dict:
+        return {
+            'version': DOC_IR_BINARY_VERSION,
+            'generator_version': __version__,
+            'root_indices': list(ir.root_indices),
+            'records': [ record._asdict() for record in ir.records ],
+        }
+
+    @staticmethod
+    def make_binary(ir: DocIr) -> bytes:
+        strings = bytearray(b'\0')
+        string_offsets: Dict[str, int] = { '': 0 }
+
+        def make_string(text) -> int:
+            if isinstance(text, (list, tuple)):
+                text = '\n'.join(map(str, text))
+            else:
+                text = str(text)
+
+            if text not in string_offsets:
+                string_offsets[text] = len(strings)
+                strings.extend(text.encode('utf-8'))
+                strings.append(0)
+
+            return string_offsets[text]
+
+        field_indices = list(ir.root_indices)
+        records = bytearray()
+
+        for record in ir.records:
+            flags = 0
+            value = 0
+            size = 0
+            bit_from, bit_to = 0, 0
+
+            if record.value is not None:
+                flags |= DOC_IR_BINARY_FLAG_VALUE
+                if isinstance(record.value, int):
+                    value = record.value
+                else:
+                    flags |= DOC_IR_BINARY_FLAG_VALUE_STRING
+                    value = make_string(str(record.value))
+
+            if record.size is not None:
+                flags |= DOC_IR_BINARY_FLAG_SIZE
+                size = record.size
+
+            if record.bit is not None:
+                flags |= DOC_IR_BINARY_FLAG_BIT
+                bit_from, bit_to = record.bit
+
+            if isinstance(record.see, tuple):
+                flags |= DOC_IR_BINARY_FLAG_SEE_LIST
+
+            if isinstance(record.reference, tuple):
+                flags |= DOC_IR_BINARY_FLAG_REFERENCE_LIST
+
+            records += DOC_IR_BINARY_RECORD.pack(
+                value,
+                record.parent_index,
+                len(field_indices),
+                len(record.field_indices),
+                DOC_TYPES.index(record.type),
+                flags,
+                bit_from,
+                bit_to,
+                size,
+                *[ make_string(getattr(record, name)) for name in DOC_IR_BINARY_STRINGS ]
+            )
+
+            field_indices.extend(record.field_indices)
+
+        #
+        # Keep every section 8-byte aligned, so the file can be memory-mapped
+        # and accessed in place.
+        #
+        def align(data: bytes) -> bytes:
+            return bytes(data) + b'\0' * (-len(data) % 8)
+
+        field_indices_data = align(struct.pack(f'<{len(field_indices)}I', *field_indices))
+        strings_data = align(strings)
+
+        records_offset = DOC_IR_BINARY_HEADER.size
+        records_offset += -records_offset % 8
+        field_indices_offset = records_offset + len(records)
+        strings_offset = field_indices_offset + len(field_indices_data)
+
+        header = align(DOC_IR_BINARY_HEADER.pack(
+            DOC_IR_BINARY_MAGIC,
+            DOC_IR_BINARY_VERSION,
+            DOC_IR_BINARY_HEADER.size,
+            len(ir.records),
+            DOC_IR_BINARY_RECORD.size,
+            records_offset,
+            field_indices_offset,
+            len(field_indices),
+            strings_offset,
+            len(strings),
+            len(ir.root_indices)
+        ))
+
+        return header + bytes(records) + field_indices_data + strings_data
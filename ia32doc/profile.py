@@ -0,0 +1,177 @@
+from typing import Dict, List, TextIO, Tuple
+
+import contextlib
+import json
+import sys
+import time
+
+try:
+    import resource
+except ImportError:
+    resource = None
+
+DOC_PROFILE_PHASES = [
+    'parse',        # Loading of YAML files (Doc.load).
+    'map',          # Mapping of parsed YAML into DocBase objects (Doc.map_class).
+    'resolve',      # Resolving of DocBase objects (DocIr).
+    'wrap',         # Text wrapping (DocText.wrap).
+    'emit',         # Emitting of output files (DocProcessor).
+]
+
+
+class DocProfile(object):
+    '''
+    Collects exclusive timings of generator phases, i.e. the time measured
+    by a nested measure() (e.g. parsing of included file during mapping of
+    the parent file) is not accounted to the enclosing one.
+    '''
+
+    enabled = False
+
+    #
+    # (phase, key) -> [exclusive time in seconds, number of calls]
+    #
+    timings: Dict[Tuple[str, str], List] = { }
+
+    #
+    # filename -> { bytes, lines, seconds }
+    #
+    outputs: Dict[str, dict] = { }
+
+    #
+    # Stack of [start time, time of nested measurements].
+    #
+    _stack = []
+
+    @staticmethod
+    @contextlib.contextmanager
+    def measure(phase: str, key: str=''):
+        if not DocProfile.enabled:
+            yield
+            return
+
+        frame = [ time.perf_counter(), 0.0 ]
+        DocProfile._stack.append(frame)
+
+        try:
+            yield
+        finally:
+            DocProfile._stack.pop()
+
+            elapsed = time.perf_counter() - frame[0]
+            if DocProfile._stack:
+                DocProfile._stack[-1][1] += elapsed
+
+            timing = DocProfile.timings.setdefault((phase, key), [ 0.0, 0 ])
+            timing[0] += elapsed - frame[1]
+            timing[1] += 1
+
+    @staticmethod
+    def add_output(filename: str, content: bytes, seconds: float) -> None:
+        if not DocProfile.enabled:
+            return
+
+        DocProfile.outputs[filename] = {
+            'bytes': len(content),
+            'lines': content.count(b'\n'),
+            'seconds': seconds,
+        }
+
+    @staticmethod
+    def reset() -> None:
+        DocProfile.timings = { }
+        DocProfile.outputs = { }
+        DocProfile._stack = []
+
+    @staticmethod
+    def collect() -> dict:
+        return {
+            'timings': [ [ phase, key, seconds, count ] for (phase, key), (seconds, count) in DocProfile.timings.items() ],
+            'outputs': DocProfile.outputs,
+        }
+
+    @staticmethod
+    def merge(profile: dict) -> None:
+        for phase, key, seconds, count in profile['timings']:
+            timing = DocProfile.timings.setdefault((phase, key), [ 0.0, 0 ])
+            timing[0] += seconds
+            timing[1] += count
+
+        DocProfile.outputs.update(profile['outputs'])
+
+    @staticmethod
+    def peak_memory() -> dict:
+        #
+        # ru_maxrss is in kilobytes on Linux, but in bytes on macOS.
+        #
+        if resource is None:
+            return { 'self': None, 'children': None }
+
+        scale = 1 if sys.platform == 'darwin' else 1024
+        return {
+            'self': resource.getrusage(resource.RUSAGE_SELF).ru_maxrss * scale,
+            'children': resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss * scale,
+        }
+
+    @staticmethod
+    def make_report() -> dict:
+        phases = { phase: 0.0 for phase in DOC_PROFILE_PHASES }
+        files = { }
+        groups = { }
+
+        for (phase, key), (seconds, count) in DocProfile.timings.items():
+            phases[phase] = phases.get(phase, 0.0) + seconds
+
+            if phase in [ 'parse', 'map' ] and key:
+                files.setdefault(key, { 'parse': 0.0, 'map': 0.0 })[phase] += seconds
+            elif phase == 'emit' and key:
+                groups[key] = seconds
+
+        return {
+            'phases': phases,
+            'files': files,
+            'groups': groups,
+            'outputs': DocProfile.outputs,
+            'peak_memory': DocProfile.peak_memory(),
+        }
+
+    @staticmethod
+    def print_report(file: TextIO=sys.stderr) -> None:
+        report = DocProfile.make_report()
+
+        def ms(seconds: float) -> str:
+            return f'{seconds * 1000:10.1f} ms'
+
+        print(f'Phases (exclusive):', file=file)
+        for phase, seconds in report['phases'].items():
+            print(f'  {phase:<60} {ms(seconds)}', file=file)
+
+        print(f'', file=file)
+        print(f'Files (parse / map):', file=file)
+        for path, timing in sorted(report['files'].items(), key=lambda item: -sum(item[1].values())):
+            print(f'  {path:<60} {ms(timing["parse"])} {ms(timing["map"])}', file=file)
+
+        print(f'', file=file)
+        print(f'Groups (emit, excluding text wrapping):', file=file)
+        for group, seconds in sorted(report['groups'].items(), key=lambda item: -item[1]):
+            print(f'  {group:<60} {ms(seconds)}', file=file)
+
+        print(f'', file=file)
+        print(f'Outputs:', file=file)
+        for filename, output in report['outputs'].items():
+            print(
+                f'  {filename:<60} {ms(output["seconds"])} {output["bytes"]:>10} bytes {output["lines"]:>8} lines',
+                file=file
+            )
+
+        print(f'', file=file)
+        print(f'Peak memory:', file=file)
+        for process, peak_memory in report['peak_memory'].items():
+            if peak_memory is not None:
+                print(f'  {process:<60} {peak_memory / (1024 * 1024):10.1f} MiB', file=file)
+
+    @staticmethod
+    def write_report(filename: str) -> None:
+        with open(filename, 'w') as f:
+            json.dump(DocProfile.make_report(), f, indent=2)
+            f.write('\n')
@@ -1,5 +1,7 @@
 from typing import List
 
+from .profile import DocProfile
+
 
 class DocTextCase(object):
     #
@@ -151,10 +153,11 @@ class DocText(object):
 
     @staticmethod
     def wrap(text: str, width: int=80, justify: bool=False) -> List[str]:
-        result = []
-        paragraph_list = DocTextWrapper.to_paragraphs(text)
-        for paragraph in paragraph_list:
-            line_list = DocTextWrapper.wrap_paragraph(paragraph, width, justify)
-            result.extend(line_list)
-
-        return result
+        with DocProfile.measure('wrap'):
+            result = []
+            paragraph_list = DocTextWrapper.to_paragraphs(text)
+            for paragraph in paragraph_list:
+                line_list = DocTextWrapper.wrap_paragraph(paragraph, width, justify)
+                result.extend(line_list)
+
+            return result
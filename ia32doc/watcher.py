@@ -0,0 +1,102 @@
+from typing import Dict, List, Optional, Set
+
+import os
+import sys
+import time
+import traceback
+
+from .doc import Doc, DocBase
+from .generator import DocGenerator
+
+
+class DocWatcher(object):
+    '''
+    Keeps the parsed document tree resident and polls modification times of
+    the YAML files (all files reachable through includes of the generator's
+    file) and of the configuration files. On change, only the changed YAML
+    files are parsed again and only the affected outputs are written
+    (with split output, only the headers containing the changed documents).
+    '''
+
+    def __init__(self, generator: DocGenerator, config_list: List[str], interval: float=0.5):
+        self.generator = generator
+        self.config_list = config_list
+        self.interval = interval
+
+    def run(self) -> None:
+        self.generator.run(self.config_list)
+        mtimes = self.snapshot()
+
+        print(f'Watching {len(mtimes)} files...', file=sys.stderr)
+
+        try:
+            while True:
+                time.sleep(self.interval)
+
+                current_mtimes = self.snapshot()
+                changed_paths = [ path for path, mtime in current_mtimes.items() if mtime != mtimes.get(path) ]
+
+                if not changed_paths:
+                    continue
+
+                try:
+                    self.update(changed_paths)
+                except Exception:
+                    #
+                    # Keep watching, the previous tree stays in place until
+                    # the file is fixed.
+                    #
+                    traceback.print_exc()
+
+                #
+                # Includes might have changed.
+                #
+                mtimes = self.snapshot()
+        except KeyboardInterrupt:
+            pass
+
+    def update(self, changed_paths: List[str]) -> None:
+        start = time.perf_counter()
+
+        changed_config_list = [ path for path in changed_paths if path in self.config_list ]
+        changed_doc_set: Optional[Set[DocBase]] = set()
+
+        for path in changed_paths:
+            if path in changed_config_list:
+                continue
+
+            print(f'Changed "{path}"...', file=sys.stderr)
+
+            for doc in self.generator.reparse(path):
+                #
+                # Find the document nested directly in the root group(s),
+                # i.e. the one having its own split header.
+                #
+                if not doc.parent:
+                    changed_doc_set = None
+                    break
+
+                while doc.parent.parent:
+                    doc = doc.parent
+
+                if changed_doc_set is not None:
+                    changed_doc_set.add(doc)
+
+        for config in self.config_list:
+            if config in changed_config_list:
+                DocGenerator.emit(config, self.generator.doc_list)
+            elif changed_doc_set is None or changed_doc_set:
+                DocGenerator.emit(config, self.generator.doc_list, changed_doc_set)
+
+        print(f'Done in {(time.perf_counter() - start) * 1000:.0f} ms.', file=sys.stderr)
+
+    def snapshot(self) -> Dict[str, Optional[int]]:
+        result = { }
+
+        for path in Doc.included_paths(self.generator.file) + self.config_list:
+            try:
+                result[path] = os.stat(path).st_mtime_ns
+            except OSError:
+                result[path] = None
+
+        return result
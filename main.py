@@ -1,52 +1,120 @@
 import argparse
 
 from ia32doc.doc import Doc
-from ia32doc.processors.c_processor import DocCProcessor
-from ia32doc.options import DocProcessorOptions
+from ia32doc.generator import DocGenerator
+from ia32doc.profile import DocProfile
+from ia32doc.watcher import DocWatcher
 
 ALL = False
+ALL_CONFIGS = [
+    'conf/default.yml',
+    'conf/default_cpp.yml',
+    'conf/default_cppm.yml',
+    'conf/constexpr_cpp.yml',
+    'conf/compact.yml',
+    'conf/defines_only.yml',
+    'conf/defines_as_enum.yml',
+    'conf/inline_functions.yml',
+    'conf/ir_binary.yml',
+    'conf/ir_json.yml',
+]
+ALL_FILE = 'yaml/Intel/index.yml'
 
 TEST = False
 TEST_CONFIG = 'conf/default.yml'
 TEST_FILE = 'yaml/Intel/VMX/index.yml'
 
+CACHE_DIRECTORY = '.cache'
 
-def process(config, file):
-    processor = DocCProcessor()
-    options = DocProcessorOptions(file=config)
-    with processor.opt.push(options):
-        processor.run(Doc.parse(file))
+
+def process(config_list, file, jobs=None):
+    generator = DocGenerator(file)
+    generator.run(config_list, jobs)
+
+
+def watch(config_list, file, interval):
+    generator = DocGenerator(file)
+    DocWatcher(generator, config_list, interval).run()
 
 
 def process_all():
-    index = 'yaml/Intel/index.yml'
-    process('conf/default.yml', index)
-    process('conf/default_cpp.yml', index)
-    process('conf/compact.yml', index)
-    process('conf/defines_only.yml', index)
+    process(ALL_CONFIGS, ALL_FILE)
 
 
 def test():
-    process(TEST_CONFIG, TEST_FILE)
+    process([ TEST_CONFIG ], TEST_FILE)
 
 
 def main():
     parser = argparse.ArgumentParser()
 
     parser.add_argument('-c', '--config',
-                        type=str, required=False,
-                        default='conf/default.yml',
-                        help='Configuration file')
+                        type=str, required=False, nargs='+',
+                        default=[ 'conf/default.yml' ],
+                        help='Configuration file(s)')
 
     parser.add_argument('-f', '--file',
-                        type=str, required=True,
+                        type=str, required=False,
+                        default=ALL_FILE,
                         help='YAML file to process')
 
+    parser.add_argument('-a', '--all',
+                        action='store_true',
+                        help='Process all configuration files')
+
+    parser.add_argument('-j', '--jobs',
+                        type=int, required=False,
+                        help='Number of configuration files processed in parallel '
+                             '(default: number of configuration files)')
+
+    parser.add_argument('--cache-directory',
+                        type=str, required=False,
+                        default=CACHE_DIRECTORY,
+                        help='Directory of the cache of parsed YAML files')
+
+    parser.add_argument('--no-cache',
+                        action='store_true',
+                        help='Do not use the cache of parsed YAML files')
+
+    parser.add_argument('-w', '--watch',
+                        action='store_true',
+                        help='Keep running and regenerate outputs affected by changes of YAML/configuration files')
+
+    parser.add_argument('--watch-interval',
+                        type=float, required=False,
+                        default=0.5,
+                        help='Interval (in seconds) of checking files for changes')
+
+    parser.add_argument('--profile',
+                        action='store_true',
+                        help='Report parse time per YAML file, emit time per group, '
+                             'size of output files and peak memory usage')
+
+    parser.add_argument('--profile-json',
+                        type=str, required=False,
+                        help='Write the profile report into JSON file (implies --profile)')
+
     args = parser.parse_args()
-    process(args.config, args.file)
+
+    Doc.cache_directory = None if args.no_cache else args.cache_directory
+    DocProfile.enabled = args.profile or bool(args.profile_json)
+
+    if args.watch:
+        watch(ALL_CONFIGS if args.all else args.config, args.file, args.watch_interval)
+        return
+
+    process(ALL_CONFIGS if args.all else args.config, args.file, args.jobs)
+
+    if args.profile:
+        DocProfile.print_report()
+
+    if args.profile_json:
+        DocProfile.write_report(args.profile_json)
 
 
 if __name__ == '__main__':
+    Doc.cache_directory = CACHE_DIRECTORY
+
     if ALL:
         process_all()
     elif TEST:
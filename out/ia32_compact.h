@@ -4903,9 +4903,9 @@ typedef union {
 #define VMCS_GUEST_PENDING_DEBUG_EXCEPTIONS                          0x00006822
 #define VMCS_GUEST_SYSENTER_ESP                                      0x00006824
 #define VMCS_GUEST_SYSENTER_EIP                                      0x00006826
-#define VMCS_GUEST_S_CET                                             0x00006C28
-#define VMCS_GUEST_SSP                                               0x00006C2A
-#define VMCS_GUEST_INTERRUPT_SSP_TABLE_ADDR                          0x00006C2C
+#define VMCS_GUEST_S_CET                                             0x00006828
+#define VMCS_GUEST_SSP                                               0x0000682A
+#define VMCS_GUEST_INTERRUPT_SSP_TABLE_ADDR                          0x0000682C
 /**
  * @}
  */
@@ -43,6 +43,8 @@ typedef union {
 
   uint64_t Flags;
 } cr0;
+#define CR0_DEFINED_BITS                                             0xE005003F
+#define CR0_RESERVED_BITS                                            0xFFFFFFFF1FFAFFC0
 
 typedef union {
   struct {
@@ -59,6 +61,8 @@ typedef union {
 
   uint64_t Flags;
 } cr3;
+#define CR3_DEFINED_BITS                                             0xFFFFFFFFF018
+#define CR3_RESERVED_BITS                                            0xFFFF000000000FE7
 
 typedef union {
   struct {
@@ -110,6 +114,8 @@ typedef union {
 
   uint64_t Flags;
 } cr4;
+#define CR4_DEFINED_BITS                                             0x776FFF
+#define CR4_RESERVED_BITS                                            0xFFFFFFFFFF889000
 
 typedef union {
   struct {
@@ -121,6 +127,8 @@ typedef union {
 
   uint64_t Flags;
 } cr8;
+#define CR8_DEFINED_BITS                                             0x0F
+#define CR8_RESERVED_BITS                                            0xFFFFFFFFFFFFFFF0
 
 /**
  * @}
@@ -149,6 +157,8 @@ typedef union {
 
   uint64_t Flags;
 } dr6;
+#define DR6_DEFINED_BITS                                             0x1E00F
+#define DR6_RESERVED_BITS                                            0xFFFFFFFFFFFE1FF0
 
 typedef union {
   struct {
@@ -200,6 +210,8 @@ typedef union {
 
   uint64_t Flags;
 } dr7;
+#define DR7_DEFINED_BITS                                             0xFFFF2BFF
+#define DR7_RESERVED_BITS                                            0xFFFFFFFF0000D400
 
 /**
  * @}
@@ -2319,8 +2331,15 @@ typedef union {
     uint64_t reserved_2                                              : 11;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_platform_id_register;
+#define IA32_PLATFORM_ID_DEFINED_BITS                                0x1C000000000000
+#define IA32_PLATFORM_ID_RESERVED_BITS                               0xFFE3FFFFFFFFFFFF
 
 #define IA32_APIC_BASE                                               0x0000001B
 typedef union {
@@ -2338,8 +2357,15 @@ typedef union {
     uint64_t reserved_3                                              : 16;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_apic_base_register;
+#define IA32_APIC_BASE_DEFINED_BITS                                  0xFFFFFFFFFD00
+#define IA32_APIC_BASE_RESERVED_BITS                                 0xFFFF0000000002FF
 
 #define IA32_FEATURE_CONTROL                                         0x0000003A
 typedef union {
@@ -2366,8 +2392,15 @@ typedef union {
     uint64_t reserved_4                                              : 43;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_feature_control_register;
+#define IA32_FEATURE_CONTROL_DEFINED_BITS                            0x16FF07
+#define IA32_FEATURE_CONTROL_RESERVED_BITS                           0xFFFFFFFFFFE900F8
 
 #define IA32_TSC_ADJUST                                              0x0000003B
 typedef struct {
@@ -2384,8 +2417,15 @@ typedef union {
 #define IA32_BIOS_SIGN_ID_MICROCODE_UPDATE_SIGNATURE                 0xFFFFFFFF00000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_bios_sign_id_register;
+#define IA32_BIOS_SIGN_ID_DEFINED_BITS                               0xFFFFFFFF00000000
+#define IA32_BIOS_SIGN_ID_RESERVED_BITS                              0xFFFFFFFF
 
 /**
  * @defgroup ia32_sgxlepubkeyhash \
@@ -2414,8 +2454,15 @@ typedef union {
     uint64_t reserved_3                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_smm_monitor_ctl_register;
+#define IA32_SMM_MONITOR_CTL_DEFINED_BITS                            0xFFFFF005
+#define IA32_SMM_MONITOR_CTL_RESERVED_BITS                           0xFFFFFFFF00000FFA
 
 typedef struct {
   uint32_t mseg_header_revision;
@@ -2473,8 +2520,15 @@ typedef union {
     uint64_t reserved_2                                              : 52;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mtrrcap_register;
+#define IA32_MTRRCAP_DEFINED_BITS                                    0xDFF
+#define IA32_MTRRCAP_RESERVED_BITS                                   0xFFFFFFFFFFFFF200
 
 #define IA32_SYSENTER_CS                                             0x00000174
 typedef union {
@@ -2487,8 +2541,15 @@ typedef union {
 #define IA32_SYSENTER_CS_NOT_USED_2                                  0xFFFFFFFF00000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_sysenter_cs_register;
+#define IA32_SYSENTER_CS_DEFINED_BITS                                0xFFFFFFFFFFFFFFFF
+#define IA32_SYSENTER_CS_RESERVED_BITS                               0x00
 
 #define IA32_SYSENTER_ESP                                            0x00000175
 #define IA32_SYSENTER_EIP                                            0x00000176
@@ -2518,8 +2579,15 @@ typedef union {
     uint64_t reserved_3                                              : 36;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mcg_cap_register;
+#define IA32_MCG_CAP_DEFINED_BITS                                    0xDFF0FFF
+#define IA32_MCG_CAP_RESERVED_BITS                                   0xFFFFFFFFF200F000
 
 #define IA32_MCG_STATUS                                              0x0000017A
 typedef union {
@@ -2535,8 +2603,15 @@ typedef union {
     uint64_t reserved_1                                              : 60;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mcg_status_register;
+#define IA32_MCG_STATUS_DEFINED_BITS                                 0x0F
+#define IA32_MCG_STATUS_RESERVED_BITS                                0xFFFFFFFFFFFFFFF0
 
 #define IA32_MCG_CTL                                                 0x0000017B
 /**
@@ -2575,8 +2650,15 @@ typedef union {
     uint64_t reserved_1                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perfevtsel_register;
+#define IA32_PERFEVTSEL_DEFINED_BITS                                 0xFFFFFFFF
+#define IA32_PERFEVTSEL_RESERVED_BITS                                0xFFFFFFFF00000000
 
 /**
  * @}
@@ -2590,8 +2672,15 @@ typedef union {
     uint64_t reserved_1                                              : 48;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perf_status_register;
+#define IA32_PERF_STATUS_DEFINED_BITS                                0xFFFF
+#define IA32_PERF_STATUS_RESERVED_BITS                               0xFFFFFFFFFFFF0000
 
 #define IA32_PERF_CTL                                                0x00000199
 typedef union {
@@ -2604,8 +2693,15 @@ typedef union {
     uint64_t reserved_2                                              : 31;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perf_ctl_register;
+#define IA32_PERF_CTL_DEFINED_BITS                                   0x10000FFFF
+#define IA32_PERF_CTL_RESERVED_BITS                                  0xFFFFFFFEFFFF0000
 
 #define IA32_CLOCK_MODULATION                                        0x0000019A
 typedef union {
@@ -2619,8 +2715,15 @@ typedef union {
     uint64_t reserved_1                                              : 59;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_clock_modulation_register;
+#define IA32_CLOCK_MODULATION_DEFINED_BITS                           0x1F
+#define IA32_CLOCK_MODULATION_RESERVED_BITS                          0xFFFFFFFFFFFFFFE0
 
 #define IA32_THERM_INTERRUPT                                         0x0000019B
 typedef union {
@@ -2649,8 +2752,15 @@ typedef union {
     uint64_t reserved_2                                              : 39;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_therm_interrupt_register;
+#define IA32_THERM_INTERRUPT_DEFINED_BITS                            0x1FFFF1F
+#define IA32_THERM_INTERRUPT_RESERVED_BITS                           0xFFFFFFFFFE0000E0
 
 #define IA32_THERM_STATUS                                            0x0000019C
 typedef union {
@@ -2697,8 +2807,15 @@ typedef union {
     uint64_t reserved_2                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_therm_status_register;
+#define IA32_THERM_STATUS_DEFINED_BITS                               0xF87FFFFF
+#define IA32_THERM_STATUS_RESERVED_BITS                              0xFFFFFFFF07800000
 
 #define IA32_MISC_ENABLE                                             0x000001A0
 typedef union {
@@ -2733,8 +2850,15 @@ typedef union {
     uint64_t reserved_8                                              : 29;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_misc_enable_register;
+#define IA32_MISC_ENABLE_DEFINED_BITS                                0x400C51889
+#define IA32_MISC_ENABLE_RESERVED_BITS                               0xFFFFFFFBFF3AE776
 
 #define IA32_ENERGY_PERF_BIAS                                        0x000001B0
 typedef union {
@@ -2744,8 +2868,15 @@ typedef union {
     uint64_t reserved_1                                              : 60;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_energy_perf_bias_register;
+#define IA32_ENERGY_PERF_BIAS_DEFINED_BITS                           0x0F
+#define IA32_ENERGY_PERF_BIAS_RESERVED_BITS                          0xFFFFFFFFFFFFFFF0
 
 #define IA32_PACKAGE_THERM_STATUS                                    0x000001B1
 typedef union {
@@ -2780,8 +2911,15 @@ typedef union {
     uint64_t reserved_2                                              : 41;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_package_therm_status_register;
+#define IA32_PACKAGE_THERM_STATUS_DEFINED_BITS                       0x7F0FFF
+#define IA32_PACKAGE_THERM_STATUS_RESERVED_BITS                      0xFFFFFFFFFF80F000
 
 #define IA32_PACKAGE_THERM_INTERRUPT                                 0x000001B2
 typedef union {
@@ -2809,8 +2947,15 @@ typedef union {
     uint64_t reserved_3                                              : 39;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_package_therm_interrupt_register;
+#define IA32_PACKAGE_THERM_INTERRUPT_DEFINED_BITS                    0x1FFFF17
+#define IA32_PACKAGE_THERM_INTERRUPT_RESERVED_BITS                   0xFFFFFFFFFE0000E8
 
 #define IA32_DEBUGCTL                                                0x000001D9
 typedef union {
@@ -2843,8 +2988,15 @@ typedef union {
     uint64_t reserved_2                                              : 48;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_debugctl_register;
+#define IA32_DEBUGCTL_DEFINED_BITS                                   0xFFC3
+#define IA32_DEBUGCTL_RESERVED_BITS                                  0xFFFFFFFFFFFF003C
 
 #define IA32_SMRR_PHYSBASE                                           0x000001F2
 typedef union {
@@ -2857,8 +3009,15 @@ typedef union {
     uint64_t reserved_2                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_smrr_physbase_register;
+#define IA32_SMRR_PHYSBASE_DEFINED_BITS                              0xFFFFF0FF
+#define IA32_SMRR_PHYSBASE_RESERVED_BITS                             0xFFFFFFFF00000F00
 
 #define IA32_SMRR_PHYSMASK                                           0x000001F3
 typedef union {
@@ -2871,8 +3030,15 @@ typedef union {
     uint64_t reserved_2                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_smrr_physmask_register;
+#define IA32_SMRR_PHYSMASK_DEFINED_BITS                              0xFFFFF800
+#define IA32_SMRR_PHYSMASK_RESERVED_BITS                             0xFFFFFFFF000007FF
 
 #define IA32_PLATFORM_DCA_CAP                                        0x000001F8
 #define IA32_CPU_DCA_CAP                                             0x000001F9
@@ -2899,8 +3065,15 @@ typedef union {
     uint64_t reserved_4                                              : 37;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_dca_0_cap_register;
+#define IA32_DCA_0_CAP_DEFINED_BITS                                  0x501E7FF
+#define IA32_DCA_0_CAP_RESERVED_BITS                                 0xFFFFFFFFFAFE1800
 
 /**
  * @defgroup ia32_mtrr_physbase \
@@ -2917,8 +3090,15 @@ typedef union {
     uint64_t reserved_2                                              : 16;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mtrr_physbase_register;
+#define IA32_MTRR_PHYSBASE_DEFINED_BITS                              0xFFFFFFFFF0FF
+#define IA32_MTRR_PHYSBASE_RESERVED_BITS                             0xFFFF000000000F00
 
 #define IA32_MTRR_PHYSBASE0                                          0x00000200
 #define IA32_MTRR_PHYSBASE1                                          0x00000202
@@ -2951,8 +3131,15 @@ typedef union {
     uint64_t reserved_2                                              : 16;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mtrr_physmask_register;
+#define IA32_MTRR_PHYSMASK_DEFINED_BITS                              0xFFFFFFFFF8FF
+#define IA32_MTRR_PHYSMASK_RESERVED_BITS                             0xFFFF000000000700
 
 #define IA32_MTRR_PHYSMASK0                                          0x00000201
 #define IA32_MTRR_PHYSMASK1                                          0x00000203
@@ -3053,8 +3240,15 @@ typedef union {
     uint64_t reserved_8                                              : 5;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_pat_register;
+#define IA32_PAT_DEFINED_BITS                                        0x707070707070707
+#define IA32_PAT_RESERVED_BITS                                       0xF8F8F8F8F8F8F8F8
 
 /**
  * @defgroup ia32_mc_ctl2 \
@@ -3103,8 +3297,15 @@ typedef union {
     uint64_t reserved_2                                              : 33;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mc_ctl2_register;
+#define IA32_MC_CTL2_DEFINED_BITS                                    0x40007FFF
+#define IA32_MC_CTL2_RESERVED_BITS                                   0xFFFFFFFFBFFF8000
 
 /**
  * @}
@@ -3123,8 +3324,15 @@ typedef union {
     uint64_t reserved_2                                              : 52;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mtrr_def_type_register;
+#define IA32_MTRR_DEF_TYPE_DEFINED_BITS                              0xC07
+#define IA32_MTRR_DEF_TYPE_RESERVED_BITS                             0xFFFFFFFFFFFFF3F8
 
 /**
  * @defgroup ia32_fixed_ctr \
@@ -3156,8 +3364,15 @@ typedef union {
     uint64_t reserved_1                                              : 50;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perf_capabilities_register;
+#define IA32_PERF_CAPABILITIES_DEFINED_BITS                          0x3FFF
+#define IA32_PERF_CAPABILITIES_RESERVED_BITS                         0xFFFFFFFFFFFFC000
 
 #define IA32_FIXED_CTR_CTRL                                          0x0000038D
 typedef union {
@@ -3189,8 +3404,15 @@ typedef union {
     uint64_t reserved_1                                              : 52;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_fixed_ctr_ctrl_register;
+#define IA32_FIXED_CTR_CTRL_DEFINED_BITS                             0xFFF
+#define IA32_FIXED_CTR_CTRL_RESERVED_BITS                            0xFFFFFFFFFFFFF000
 
 #define IA32_PERF_GLOBAL_STATUS                                      0x0000038E
 typedef union {
@@ -3228,8 +3450,15 @@ typedef union {
 #define IA32_PERF_GLOBAL_STATUS_COND_CHGD                            0x8000000000000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perf_global_status_register;
+#define IA32_PERF_GLOBAL_STATUS_DEFINED_BITS                         0xFC8000070000000F
+#define IA32_PERF_GLOBAL_STATUS_RESERVED_BITS                        0x37FFFF8FFFFFFF0
 
 #define IA32_PERF_GLOBAL_CTRL                                        0x0000038F
 typedef struct {
@@ -3262,8 +3491,15 @@ typedef union {
 #define IA32_PERF_GLOBAL_STATUS_RESET_CLEAR_COND_CHGD                0x8000000000000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perf_global_status_reset_register;
+#define IA32_PERF_GLOBAL_STATUS_RESET_DEFINED_BITS                   0xFC800007FFFFFFFF
+#define IA32_PERF_GLOBAL_STATUS_RESET_RESERVED_BITS                  0x37FFFF800000000
 
 #define IA32_PERF_GLOBAL_STATUS_SET                                  0x00000391
 typedef union {
@@ -3289,8 +3525,15 @@ typedef union {
     uint64_t reserved_3                                              : 1;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perf_global_status_set_register;
+#define IA32_PERF_GLOBAL_STATUS_SET_DEFINED_BITS                     0x7C800007FFFFFFFF
+#define IA32_PERF_GLOBAL_STATUS_SET_RESERVED_BITS                    0x837FFFF800000000
 
 #define IA32_PERF_GLOBAL_INUSE                                       0x00000392
 typedef union {
@@ -3304,8 +3547,15 @@ typedef union {
 #define IA32_PERF_GLOBAL_INUSE_PMI_IN_USE                            0x8000000000000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_perf_global_inuse_register;
+#define IA32_PERF_GLOBAL_INUSE_DEFINED_BITS                          0x80000007FFFFFFFF
+#define IA32_PERF_GLOBAL_INUSE_RESERVED_BITS                         0x7FFFFFF800000000
 
 #define IA32_PEBS_ENABLE                                             0x000003F1
 typedef union {
@@ -3320,8 +3570,15 @@ typedef union {
     uint64_t reserved_2                                              : 28;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_pebs_enable_register;
+#define IA32_PEBS_ENABLE_DEFINED_BITS                                0xF0000000F
+#define IA32_PEBS_ENABLE_RESERVED_BITS                               0xFFFFFFF0FFFFFFF0
 
 /**
  * @defgroup ia32_mc_ctl \
@@ -3498,8 +3755,15 @@ typedef union {
     uint64_t reserved_2                                              : 8;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_basic_register;
+#define IA32_VMX_BASIC_DEFINED_BITS                                  0xFF1FFFFFFFFFFF
+#define IA32_VMX_BASIC_RESERVED_BITS                                 0xFF00E00000000000
 
 #define IA32_VMX_PINBASED_CTLS                                       0x00000481
 typedef union {
@@ -3519,8 +3783,15 @@ typedef union {
     uint64_t reserved_3                                              : 56;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_pinbased_ctls_register;
+#define IA32_VMX_PINBASED_CTLS_DEFINED_BITS                          0xE9
+#define IA32_VMX_PINBASED_CTLS_RESERVED_BITS                         0xFFFFFFFFFFFFFF16
 
 #define IA32_VMX_PROCBASED_CTLS                                      0x00000482
 typedef union {
@@ -3576,8 +3847,15 @@ typedef union {
     uint64_t reserved_7                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_procbased_ctls_register;
+#define IA32_VMX_PROCBASED_CTLS_DEFINED_BITS                         0xFBF99E8C
+#define IA32_VMX_PROCBASED_CTLS_RESERVED_BITS                        0xFFFFFFFF04066173
 
 #define IA32_VMX_EXIT_CTLS                                           0x00000483
 typedef union {
@@ -3612,8 +3890,15 @@ typedef union {
     uint64_t reserved_6                                              : 39;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_exit_ctls_register;
+#define IA32_VMX_EXIT_CTLS_DEFINED_BITS                              0x1FC9204
+#define IA32_VMX_EXIT_CTLS_RESERVED_BITS                             0xFFFFFFFFFE036DFB
 
 #define IA32_VMX_ENTRY_CTLS                                          0x00000484
 typedef union {
@@ -3647,8 +3932,15 @@ typedef union {
     uint64_t reserved_5                                              : 43;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_entry_ctls_register;
+#define IA32_VMX_ENTRY_CTLS_DEFINED_BITS                             0x17EE04
+#define IA32_VMX_ENTRY_CTLS_RESERVED_BITS                            0xFFFFFFFFFFE811FB
 
 #define IA32_VMX_MISC                                                0x00000485
 typedef union {
@@ -3679,8 +3971,15 @@ typedef union {
 #define IA32_VMX_MISC_MSEG_ID                                        0xFFFFFFFF00000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_misc_register;
+#define IA32_VMX_MISC_DEFINED_BITS                                   0xFFFFFFFF7FFFC1FF
+#define IA32_VMX_MISC_RESERVED_BITS                                  0x80003E00
 
 #define IA32_VMX_CR0_FIXED0                                          0x00000486
 #define IA32_VMX_CR0_FIXED1                                          0x00000487
@@ -3701,8 +4000,15 @@ typedef union {
     uint64_t reserved_2                                              : 49;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_vmcs_enum_register;
+#define IA32_VMX_VMCS_ENUM_DEFINED_BITS                              0x6FFF
+#define IA32_VMX_VMCS_ENUM_RESERVED_BITS                             0xFFFFFFFFFFFF9000
 
 #define IA32_VMX_PROCBASED_CTLS2                                     0x0000048B
 typedef union {
@@ -3766,8 +4072,15 @@ typedef union {
     uint64_t reserved_3                                              : 35;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_procbased_ctls2_register;
+#define IA32_VMX_PROCBASED_CTLS2_DEFINED_BITS                        0x17DFFFFF
+#define IA32_VMX_PROCBASED_CTLS2_RESERVED_BITS                       0xFFFFFFFFE8200000
 
 #define IA32_VMX_EPT_VPID_CAP                                        0x0000048C
 typedef union {
@@ -3815,8 +4128,15 @@ typedef union {
     uint64_t reserved_9                                              : 20;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_ept_vpid_cap_register;
+#define IA32_VMX_EPT_VPID_CAP_DEFINED_BITS                           0xF0106734141
+#define IA32_VMX_EPT_VPID_CAP_RESERVED_BITS                          0xFFFFF0FEF98CBEBE
 
 /**
  * @defgroup ia32_vmx_true_ctls \
@@ -3835,8 +4155,15 @@ typedef union {
 #define IA32_VMX_TRUE_CTLS_ALLOWED_1_SETTINGS                        0xFFFFFFFF00000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_true_ctls_register;
+#define IA32_VMX_TRUE_CTLS_DEFINED_BITS                              0xFFFFFFFFFFFFFFFF
+#define IA32_VMX_TRUE_CTLS_RESERVED_BITS                             0x00
 
 /**
  * @}
@@ -3850,8 +4177,15 @@ typedef union {
     uint64_t reserved_1                                              : 63;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_vmx_vmfunc_register;
+#define IA32_VMX_VMFUNC_DEFINED_BITS                                 0x01
+#define IA32_VMX_VMFUNC_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 /**
  * @defgroup ia32_a_pmc \
@@ -3878,8 +4212,15 @@ typedef union {
     uint64_t reserved_1                                              : 63;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_mcg_ext_ctl_register;
+#define IA32_MCG_EXT_CTL_DEFINED_BITS                                0x01
+#define IA32_MCG_EXT_CTL_RESERVED_BITS                               0xFFFFFFFFFFFFFFFE
 
 #define IA32_SGX_SVN_STATUS                                          0x00000500
 typedef union {
@@ -3892,8 +4233,15 @@ typedef union {
     uint64_t reserved_2                                              : 40;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_sgx_svn_status_register;
+#define IA32_SGX_SVN_STATUS_DEFINED_BITS                             0xFF0001
+#define IA32_SGX_SVN_STATUS_RESERVED_BITS                            0xFFFFFFFFFF00FFFE
 
 #define IA32_RTIT_OUTPUT_BASE                                        0x00000560
 typedef union {
@@ -3904,8 +4252,15 @@ typedef union {
     uint64_t reserved_2                                              : 16;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_rtit_output_base_register;
+#define IA32_RTIT_OUTPUT_BASE_DEFINED_BITS                           0xFFFFFFFFFF80
+#define IA32_RTIT_OUTPUT_BASE_RESERVED_BITS                          0xFFFF00000000007F
 
 #define IA32_RTIT_OUTPUT_MASK_PTRS                                   0x00000561
 typedef union {
@@ -3918,8 +4273,15 @@ typedef union {
 #define IA32_RTIT_OUTPUT_MASK_PTRS_OUTPUT_OFFSET                     0xFFFFFFFF00000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_rtit_output_mask_ptrs_register;
+#define IA32_RTIT_OUTPUT_MASK_PTRS_DEFINED_BITS                      0xFFFFFFFFFFFFFFFF
+#define IA32_RTIT_OUTPUT_MASK_PTRS_RESERVED_BITS                     0x00
 
 #define IA32_RTIT_CTL                                                0x00000570
 typedef union {
@@ -3975,8 +4337,15 @@ typedef union {
     uint64_t reserved_5                                              : 7;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_rtit_ctl_register;
+#define IA32_RTIT_CTL_DEFINED_BITS                                   0x100FFFF0F7BFFFF
+#define IA32_RTIT_CTL_RESERVED_BITS                                  0xFEFF0000F0840000
 
 #define IA32_RTIT_STATUS                                             0x00000571
 typedef union {
@@ -4002,8 +4371,15 @@ typedef union {
     uint64_t reserved_3                                              : 15;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_rtit_status_register;
+#define IA32_RTIT_STATUS_DEFINED_BITS                                0x1FFFF000000F7
+#define IA32_RTIT_STATUS_RESERVED_BITS                               0xFFFE0000FFFFFF08
 
 #define IA32_RTIT_CR3_MATCH                                          0x00000572
 typedef union {
@@ -4013,8 +4389,15 @@ typedef union {
 #define IA32_RTIT_CR3_MATCH_CR3_VALUE_TO_MATCH                       0xFFFFFFFFFFFFFFE0
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_rtit_cr3_match_register;
+#define IA32_RTIT_CR3_MATCH_DEFINED_BITS                             0xFFFFFFFFFFFFFFE0
+#define IA32_RTIT_CR3_MATCH_RESERVED_BITS                            0x1F
 
 /**
  * @defgroup ia32_rtit_addr \
@@ -4055,8 +4438,15 @@ typedef union {
 #define IA32_RTIT_ADDR_SIGN_EXT_VA                                   0xFFFF000000000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_rtit_addr_register;
+#define IA32_RTIT_ADDR_DEFINED_BITS                                  0xFFFFFFFFFFFFFFFF
+#define IA32_RTIT_ADDR_RESERVED_BITS                                 0x00
 
 /**
  * @}
@@ -4072,8 +4462,15 @@ typedef union {
     uint64_t reserved_1                                              : 63;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_pm_enable_register;
+#define IA32_PM_ENABLE_DEFINED_BITS                                  0x01
+#define IA32_PM_ENABLE_RESERVED_BITS                                 0xFFFFFFFFFFFFFFFE
 
 #define IA32_HWP_CAPABILITIES                                        0x00000771
 typedef union {
@@ -4089,8 +4486,15 @@ typedef union {
     uint64_t reserved_1                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_hwp_capabilities_register;
+#define IA32_HWP_CAPABILITIES_DEFINED_BITS                           0xFFFFFFFF
+#define IA32_HWP_CAPABILITIES_RESERVED_BITS                          0xFFFFFFFF00000000
 
 #define IA32_HWP_REQUEST_PKG                                         0x00000772
 typedef union {
@@ -4108,8 +4512,15 @@ typedef union {
     uint64_t reserved_1                                              : 22;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_hwp_request_pkg_register;
+#define IA32_HWP_REQUEST_PKG_DEFINED_BITS                            0x3FFFFFFFFFF
+#define IA32_HWP_REQUEST_PKG_RESERVED_BITS                           0xFFFFFC0000000000
 
 #define IA32_HWP_INTERRUPT                                           0x00000773
 typedef union {
@@ -4121,8 +4532,15 @@ typedef union {
     uint64_t reserved_1                                              : 62;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_hwp_interrupt_register;
+#define IA32_HWP_INTERRUPT_DEFINED_BITS                              0x03
+#define IA32_HWP_INTERRUPT_RESERVED_BITS                             0xFFFFFFFFFFFFFFFC
 
 #define IA32_HWP_REQUEST                                             0x00000774
 typedef union {
@@ -4142,8 +4560,15 @@ typedef union {
     uint64_t reserved_1                                              : 21;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_hwp_request_register;
+#define IA32_HWP_REQUEST_DEFINED_BITS                                0x7FFFFFFFFFF
+#define IA32_HWP_REQUEST_RESERVED_BITS                               0xFFFFF80000000000
 
 #define IA32_HWP_STATUS                                              0x00000777
 typedef union {
@@ -4156,8 +4581,15 @@ typedef union {
     uint64_t reserved_2                                              : 61;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_hwp_status_register;
+#define IA32_HWP_STATUS_DEFINED_BITS                                 0x05
+#define IA32_HWP_STATUS_RESERVED_BITS                                0xFFFFFFFFFFFFFFFA
 
 #define IA32_X2APIC_APICID                                           0x00000802
 #define IA32_X2APIC_VERSION                                          0x00000803
@@ -4243,8 +4675,15 @@ typedef union {
     uint64_t reserved_2                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_debug_interface_register;
+#define IA32_DEBUG_INTERFACE_DEFINED_BITS                            0xC0000001
+#define IA32_DEBUG_INTERFACE_RESERVED_BITS                           0xFFFFFFFF3FFFFFFE
 
 #define IA32_L3_QOS_CFG                                              0x00000C81
 typedef union {
@@ -4254,8 +4693,15 @@ typedef union {
     uint64_t reserved_1                                              : 63;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_l3_qos_cfg_register;
+#define IA32_L3_QOS_CFG_DEFINED_BITS                                 0x01
+#define IA32_L3_QOS_CFG_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 #define IA32_L2_QOS_CFG                                              0x00000C82
 typedef union {
@@ -4265,8 +4711,15 @@ typedef union {
     uint64_t reserved_1                                              : 63;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_l2_qos_cfg_register;
+#define IA32_L2_QOS_CFG_DEFINED_BITS                                 0x01
+#define IA32_L2_QOS_CFG_RESERVED_BITS                                0xFFFFFFFFFFFFFFFE
 
 #define IA32_QM_EVTSEL                                               0x00000C8D
 typedef union {
@@ -4278,8 +4731,15 @@ typedef union {
 #define IA32_QM_EVTSEL_RESOURCE_MONITORING_ID                        0xFFFFFFFF00000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_qm_evtsel_register;
+#define IA32_QM_EVTSEL_DEFINED_BITS                                  0xFFFFFFFF000000FF
+#define IA32_QM_EVTSEL_RESERVED_BITS                                 0xFFFFFF00
 
 #define IA32_QM_CTR                                                  0x00000C8E
 typedef union {
@@ -4292,8 +4752,15 @@ typedef union {
 #define IA32_QM_CTR_ERROR                                            0x8000000000000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_qm_ctr_register;
+#define IA32_QM_CTR_DEFINED_BITS                                     0xFFFFFFFFFFFFFFFF
+#define IA32_QM_CTR_RESERVED_BITS                                    0x00
 
 #define IA32_PQR_ASSOC                                               0x00000C8F
 typedef union {
@@ -4304,8 +4771,15 @@ typedef union {
 #define IA32_PQR_ASSOC_COS                                           0xFFFFFFFF00000000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_pqr_assoc_register;
+#define IA32_PQR_ASSOC_DEFINED_BITS                                  0xFFFFFFFFFFFFFFFF
+#define IA32_PQR_ASSOC_RESERVED_BITS                                 0x00
 
 #define IA32_BNDCFGS                                                 0x00000D90
 typedef union {
@@ -4319,8 +4793,15 @@ typedef union {
 #define IA32_BNDCFGS_BOUND_DIRECTORY_BASE_ADDRESS                    0xFFFFFFFFFFFFF000
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_bndcfgs_register;
+#define IA32_BNDCFGS_DEFINED_BITS                                    0xFFFFFFFFFFFFF003
+#define IA32_BNDCFGS_RESERVED_BITS                                   0xFFC
 
 #define IA32_XSS                                                     0x00000DA0
 typedef union {
@@ -4331,8 +4812,15 @@ typedef union {
     uint64_t reserved_2                                              : 55;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_xss_register;
+#define IA32_XSS_DEFINED_BITS                                        0x100
+#define IA32_XSS_RESERVED_BITS                                       0xFFFFFFFFFFFFFEFF
 
 #define IA32_PKG_HDC_CTL                                             0x00000DB0
 typedef union {
@@ -4342,8 +4830,15 @@ typedef union {
     uint64_t reserved_1                                              : 63;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_pkg_hdc_ctl_register;
+#define IA32_PKG_HDC_CTL_DEFINED_BITS                                0x01
+#define IA32_PKG_HDC_CTL_RESERVED_BITS                               0xFFFFFFFFFFFFFFFE
 
 #define IA32_PM_CTL1                                                 0x00000DB1
 typedef union {
@@ -4353,8 +4848,15 @@ typedef union {
     uint64_t reserved_1                                              : 63;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_pm_ctl1_register;
+#define IA32_PM_CTL1_DEFINED_BITS                                    0x01
+#define IA32_PM_CTL1_RESERVED_BITS                                   0xFFFFFFFFFFFFFFFE
 
 #define IA32_THREAD_STALL                                            0x00000DB2
 typedef struct {
@@ -4377,8 +4879,15 @@ typedef union {
     uint64_t reserved_3                                              : 52;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_efer_register;
+#define IA32_EFER_DEFINED_BITS                                       0xD01
+#define IA32_EFER_RESERVED_BITS                                      0xFFFFFFFFFFFFF2FE
 
 #define IA32_STAR                                                    0xC0000081
 #define IA32_LSTAR                                                   0xC0000082
@@ -4395,8 +4904,15 @@ typedef union {
     uint64_t reserved_1                                              : 32;
   };
 
+  struct {
+    uint32_t Low;
+    uint32_t High;
+  };
+
   uint64_t Flags;
 } ia32_tsc_aux_register;
+#define IA32_TSC_AUX_DEFINED_BITS                                    0xFFFFFFFF
+#define IA32_TSC_AUX_RESERVED_BITS                                   0xFFFFFFFF00000000
 
 /**
  * @}
@@ -4445,6 +4961,8 @@ typedef union {
 
   uint32_t Flags;
 } pde_4mb_32;
+#define PDE_4MB_32_DEFINED_BITS                                      0xFFDFFFFF
+#define PDE_4MB_32_RESERVED_BITS                                     0x200000
 
 typedef union {
   struct {
@@ -4472,6 +4990,8 @@ typedef union {
 
   uint32_t Flags;
 } pde_32;
+#define PDE_32_DEFINED_BITS                                          0xFFFFFFFF
+#define PDE_32_RESERVED_BITS                                         0x00
 
 typedef union {
   struct {
@@ -4501,6 +5021,8 @@ typedef union {
 
   uint32_t Flags;
 } pte_32;
+#define PTE_32_DEFINED_BITS                                          0xFFFFFFFF
+#define PTE_32_RESERVED_BITS                                         0x00
 
 typedef union {
   struct {
@@ -4530,6 +5052,8 @@ typedef union {
 
   uint32_t Flags;
 } pt_entry_32;
+#define PT_ENTRY_32_DEFINED_BITS                                     0xFFFFFFFF
+#define PT_ENTRY_32_RESERVED_BITS                                    0x00
 
 /**
  * @defgroup paging_structures_entry_count_32 \
@@ -4581,6 +5105,8 @@ typedef union {
 
   uint64_t Flags;
 } pml4e_64;
+#define PML4E_64_DEFINED_BITS                                        0xFFF0FFFFFFFFFFBF
+#define PML4E_64_RESERVED_BITS                                       0xF000000000040
 
 typedef union {
   struct {
@@ -4620,6 +5146,8 @@ typedef union {
 
   uint64_t Flags;
 } pdpte_1gb_64;
+#define PDPTE_1GB_64_DEFINED_BITS                                    0xFFF0FFFFC0001FFF
+#define PDPTE_1GB_64_RESERVED_BITS                                   0xF00003FFFE000
 
 typedef union {
   struct {
@@ -4651,6 +5179,8 @@ typedef union {
 
   uint64_t Flags;
 } pdpte_64;
+#define PDPTE_64_DEFINED_BITS                                        0xFFF0FFFFFFFFFFBF
+#define PDPTE_64_RESERVED_BITS                                       0xF000000000040
 
 typedef union {
   struct {
@@ -4690,6 +5220,8 @@ typedef union {
 
   uint64_t Flags;
 } pde_2mb_64;
+#define PDE_2MB_64_DEFINED_BITS                                      0xFFF0FFFFFFE01FFF
+#define PDE_2MB_64_RESERVED_BITS                                     0xF0000001FE000
 
 typedef union {
   struct {
@@ -4721,6 +5253,8 @@ typedef union {
 
   uint64_t Flags;
 } pde_64;
+#define PDE_64_DEFINED_BITS                                          0xFFF0FFFFFFFFFFBF
+#define PDE_64_RESERVED_BITS                                         0xF000000000040
 
 typedef union {
   struct {
@@ -4757,6 +5291,8 @@ typedef union {
 
   uint64_t Flags;
 } pte_64;
+#define PTE_64_DEFINED_BITS                                          0xFFF0FFFFFFFFFFFF
+#define PTE_64_RESERVED_BITS                                         0xF000000000000
 
 typedef union {
   struct {
@@ -4793,6 +5329,8 @@ typedef union {
 
   uint64_t Flags;
 } pt_entry_64;
+#define PT_ENTRY_64_DEFINED_BITS                                     0xFFF0FFFFFFFFFFFF
+#define PT_ENTRY_64_RESERVED_BITS                                    0xF000000000000
 
 /**
  * @defgroup paging_structures_entry_count_64 \
@@ -4859,6 +5397,8 @@ typedef union {
 
   uint32_t Flags;
 } segment_access_rights;
+#define SEGMENT_ACCESS_RIGHTS_DEFINED_BITS                           0xF0FF00
+#define SEGMENT_ACCESS_RIGHTS_RESERVED_BITS                          0xFF0F00FF
 
 typedef struct {
   uint16_t segment_limit_low;
@@ -4994,6 +5534,8 @@ typedef union {
 
   uint16_t Flags;
 } segment_selector;
+#define SEGMENT_SELECTOR_DEFINED_BITS                                0xFFFF
+#define SEGMENT_SELECTOR_RESERVED_BITS                               0x00
 
 /**
  * @}
@@ -5149,6 +5691,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_debug_exception;
+#define VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION_DEFINED_BITS          0x600F
+#define VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION_RESERVED_BITS         0xFFFFFFFFFFFF9FF0
 
 typedef union {
   struct {
@@ -5166,6 +5710,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_task_switch;
+#define VMX_EXIT_QUALIFICATION_TASK_SWITCH_DEFINED_BITS              0xC000FFFF
+#define VMX_EXIT_QUALIFICATION_TASK_SWITCH_RESERVED_BITS             0xFFFFFFFF3FFF0000
 
 typedef union {
   struct {
@@ -5213,6 +5759,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_cr_access;
+#define VMX_EXIT_QUALIFICATION_CR_ACCESS_DEFINED_BITS                0xFFFF0F7F
+#define VMX_EXIT_QUALIFICATION_CR_ACCESS_RESERVED_BITS               0xFFFFFFFF0000F080
 
 typedef union {
   struct {
@@ -5237,6 +5785,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_dr_access;
+#define VMX_EXIT_QUALIFICATION_DR_ACCESS_DEFINED_BITS                0xF17
+#define VMX_EXIT_QUALIFICATION_DR_ACCESS_RESERVED_BITS               0xFFFFFFFFFFFFF0E8
 
 typedef union {
   struct {
@@ -5269,6 +5819,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_io_inst;
+#define VMX_EXIT_QUALIFICATION_IO_INST_DEFINED_BITS                  0xFFFF007F
+#define VMX_EXIT_QUALIFICATION_IO_INST_RESERVED_BITS                 0xFFFFFFFF0000FF80
 
 typedef union {
   struct {
@@ -5287,6 +5839,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_apic_access;
+#define VMX_EXIT_QUALIFICATION_APIC_ACCESS_DEFINED_BITS              0xFFFF
+#define VMX_EXIT_QUALIFICATION_APIC_ACCESS_RESERVED_BITS             0xFFFFFFFFFFFF0000
 
 typedef union {
   struct {
@@ -5321,6 +5875,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_exit_qualification_ept_violation;
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_DEFINED_BITS            0x1FFF
+#define VMX_EXIT_QUALIFICATION_EPT_VIOLATION_RESERVED_BITS           0xFFFFFFFFFFFFE000
 
 /**
  * @}
@@ -5344,6 +5900,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_ins_outs;
+#define VMX_VMEXIT_INSTRUCTION_INFO_INS_OUTS_DEFINED_BITS            0x38380
+#define VMX_VMEXIT_INSTRUCTION_INFO_INS_OUTS_RESERVED_BITS           0xFFFFFFFFFFFC7C7F
 
 typedef union {
   struct {
@@ -5370,6 +5928,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_invalidate;
+#define VMX_VMEXIT_INSTRUCTION_INFO_INVALIDATE_DEFINED_BITS          0xFFFF8383
+#define VMX_VMEXIT_INSTRUCTION_INFO_INVALIDATE_RESERVED_BITS         0xFFFFFFFF00007C7C
 
 typedef union {
   struct {
@@ -5399,6 +5959,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_gdtr_idtr_access;
+#define VMX_VMEXIT_INSTRUCTION_INFO_GDTR_IDTR_ACCESS_DEFINED_BITS    0x3FFF8B83
+#define VMX_VMEXIT_INSTRUCTION_INFO_GDTR_IDTR_ACCESS_RESERVED_BITS   0xFFFFFFFFC000747C
 
 typedef union {
   struct {
@@ -5429,6 +5991,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_ldtr_tr_access;
+#define VMX_VMEXIT_INSTRUCTION_INFO_LDTR_TR_ACCESS_DEFINED_BITS      0x3FFF87FB
+#define VMX_VMEXIT_INSTRUCTION_INFO_LDTR_TR_ACCESS_RESERVED_BITS     0xFFFFFFFFC0007804
 
 typedef union {
   struct {
@@ -5443,6 +6007,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_rdrand_rdseed;
+#define VMX_VMEXIT_INSTRUCTION_INFO_RDRAND_RDSEED_DEFINED_BITS       0x1878
+#define VMX_VMEXIT_INSTRUCTION_INFO_RDRAND_RDSEED_RESERVED_BITS      0xFFFFFFFFFFFFE787
 
 typedef union {
   struct {
@@ -5467,6 +6033,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_vmx_and_xsaves;
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMX_AND_XSAVES_DEFINED_BITS      0xFFF8383
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMX_AND_XSAVES_RESERVED_BITS     0xFFFFFFFFF0007C7C
 
 typedef union {
   struct {
@@ -5497,6 +6065,8 @@ typedef union {
 
   uint64_t Flags;
 } vmx_vmexit_instruction_info_vmread_vmwrite;
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMREAD_VMWRITE_DEFINED_BITS      0xFFFF87FB
+#define VMX_VMEXIT_INSTRUCTION_INFO_VMREAD_VMWRITE_RESERVED_BITS     0xFFFFFFFF00007804
 
 /**
  * @}
@@ -5528,6 +6098,8 @@ typedef union {
 
   uint32_t Flags;
 } vmx_segment_access_rights;
+#define VMX_SEGMENT_ACCESS_RIGHTS_DEFINED_BITS                       0x1F0FF
+#define VMX_SEGMENT_ACCESS_RIGHTS_RESERVED_BITS                      0xFFFE0F00
 
 typedef union {
   struct {
@@ -5546,6 +6118,8 @@ typedef union {
 
   uint32_t Flags;
 } vmx_interruptibility_state;
+#define VMX_INTERRUPTIBILITY_STATE_DEFINED_BITS                      0x1F
+#define VMX_INTERRUPTIBILITY_STATE_RESERVED_BITS                     0xFFFFFFE0
 
 #define VMX_ACTIVE                                                   0x00000000
 #define VMX_HLT                                                      0x00000001
@@ -5581,6 +6155,8 @@ typedef union {
 
   uint32_t Flags;
 } vmx_vmexit_reason;
+#define VMX_VMEXIT_REASON_DEFINED_BITS                               0xB801FFFF
+#define VMX_VMEXIT_REASON_RESERVED_BITS                              0x47FE0000
 
 typedef struct {
 #define IO_BITMAP_A_MIN                                              0x00000000
@@ -5624,6 +6200,8 @@ typedef union {
 
   uint64_t Flags;
 } eptp;
+#define EPTP_DEFINED_BITS                                            0xFFFFFFFFF07F
+#define EPTP_RESERVED_BITS                                           0xFFFF000000000F80
 
 typedef union {
   struct {
@@ -5647,6 +6225,8 @@ typedef union {
 
   uint64_t Flags;
 } epml4e;
+#define EPML4E_DEFINED_BITS                                          0xFFFFFFFFF507
+#define EPML4E_RESERVED_BITS                                         0xFFFF000000000AF8
 
 typedef union {
   struct {
@@ -5678,6 +6258,8 @@ typedef union {
 
   uint64_t Flags;
 } ept_pdpte_1gb;
+#define EPT_PDPTE_1GB_DEFINED_BITS                                   0x8000FFFFC00007FF
+#define EPT_PDPTE_1GB_RESERVED_BITS                                  0x7FFF00003FFFF800
 
 typedef union {
   struct {
@@ -5701,6 +6283,8 @@ typedef union {
 
   uint64_t Flags;
 } ept_pdpte;
+#define EPT_PDPTE_DEFINED_BITS                                       0xFFFFFFFFF507
+#define EPT_PDPTE_RESERVED_BITS                                      0xFFFF000000000AF8
 
 typedef union {
   struct {
@@ -5732,6 +6316,8 @@ typedef union {
 
   uint64_t Flags;
 } ept_pde_2mb;
+#define EPT_PDE_2MB_DEFINED_BITS                                     0x8000FFFFFFE007FF
+#define EPT_PDE_2MB_RESERVED_BITS                                    0x7FFF0000001FF800
 
 typedef union {
   struct {
@@ -5755,6 +6341,8 @@ typedef union {
 
   uint64_t Flags;
 } ept_pde;
+#define EPT_PDE_DEFINED_BITS                                         0xFFFFFFFFF507
+#define EPT_PDE_RESERVED_BITS                                        0xFFFF000000000AF8
 
 typedef union {
   struct {
@@ -5785,6 +6373,8 @@ typedef union {
 
   uint64_t Flags;
 } ept_pte;
+#define EPT_PTE_DEFINED_BITS                                         0x8000FFFFFFFFF77F
+#define EPT_PTE_RESERVED_BITS                                        0x7FFF000000000880
 
 typedef union {
   struct {
@@ -5816,6 +6406,8 @@ typedef union {
 
   uint64_t Flags;
 } ept_entry;
+#define EPT_ENTRY_DEFINED_BITS                                       0x8000FFFFFFFFF7FF
+#define EPT_ENTRY_RESERVED_BITS                                      0x7FFF000000000800
 
 /**
  * @defgroup ept_table_level \
@@ -5914,6 +6506,8 @@ typedef union {
 
   uint16_t Flags;
 } vmcs_component_encoding;
+#define VMCS_COMPONENT_ENCODING_DEFINED_BITS                         0x7FFF
+#define VMCS_COMPONENT_ENCODING_RESERVED_BITS                        0x8000
 
 /**
  * @defgroup vmcs_16_bit \
@@ -6213,9 +6807,9 @@ typedef union {
 #define VMCS_GUEST_PENDING_DEBUG_EXCEPTIONS                          0x00006822
 #define VMCS_GUEST_SYSENTER_ESP                                      0x00006824
 #define VMCS_GUEST_SYSENTER_EIP                                      0x00006826
-#define VMCS_GUEST_S_CET                                             0x00006C28
-#define VMCS_GUEST_SSP                                               0x00006C2A
-#define VMCS_GUEST_INTERRUPT_SSP_TABLE_ADDR                          0x00006C2C
+#define VMCS_GUEST_S_CET                                             0x00006828
+#define VMCS_GUEST_SSP                                               0x0000682A
+#define VMCS_GUEST_INTERRUPT_SSP_TABLE_ADDR                          0x0000682C
 /**
  * @}
  */
@@ -6278,6 +6872,8 @@ typedef union {
 
   uint32_t Flags;
 } vmentry_interrupt_info;
+#define VMENTRY_INTERRUPT_INFO_DEFINED_BITS                          0x80000FFF
+#define VMENTRY_INTERRUPT_INFO_RESERVED_BITS                         0x7FFFF000
 
 typedef union {
   struct {
@@ -6296,6 +6892,8 @@ typedef union {
 
   uint32_t Flags;
 } vmexit_interrupt_info;
+#define VMEXIT_INTERRUPT_INFO_DEFINED_BITS                           0x80001FFF
+#define VMEXIT_INTERRUPT_INFO_RESERVED_BITS                          0x7FFFE000
 
 /**
  * @}
@@ -6404,6 +7002,8 @@ typedef union {
 
   uint32_t Flags;
 } efl;
+#define EFL_DEFINED_BITS                                             0x3F7FD7
+#define EFL_RESERVED_BITS                                            0xFFC08028
 
 typedef union {
   struct {
@@ -6451,6 +7051,8 @@ typedef union {
 
   uint64_t Flags;
 } rfl;
+#define RFL_DEFINED_BITS                                             0x3F7FD7
+#define RFL_RESERVED_BITS                                            0xFFFFFFFFFFC08028
 
 /**
  * @defgroup exceptions \
@@ -6496,6 +7098,8 @@ typedef union {
 
   uint32_t Flags;
 } exception_error_code;
+#define EXCEPTION_ERROR_CODE_DEFINED_BITS                            0xFFFF
+#define EXCEPTION_ERROR_CODE_RESERVED_BITS                           0xFFFF0000
 
 typedef union {
   struct {
@@ -6519,6 +7123,8 @@ typedef union {
 
   uint32_t Flags;
 } page_fault_exception;
+#define PAGE_FAULT_EXCEPTION_DEFINED_BITS                            0x803F
+#define PAGE_FAULT_EXCEPTION_RESERVED_BITS                           0xFFFF7FC0
 
 /**
  * @}